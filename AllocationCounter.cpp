@@ -0,0 +1,38 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+bool IsAllocationCountingCompiledIn() {
+    return BRICKBREAKER_COUNT_ALLOCATIONS != 0;
+}
+
+#if BRICKBREAKER_COUNT_ALLOCATIONS
+
+static std::atomic<unsigned long long> heapAllocationCount(0);
+
+static void* CountedAlloc(std::size_t size) {
+    heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size != 0 ? size : 1);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size) { return CountedAlloc(size); }
+void* operator new[](std::size_t size) { return CountedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+unsigned long long GetHeapAllocationCount() {
+    return heapAllocationCount.load(std::memory_order_relaxed);
+}
+
+#else
+
+unsigned long long GetHeapAllocationCount() {
+    return 0;
+}
+
+#endif
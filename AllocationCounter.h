@@ -0,0 +1,20 @@
+#pragma once
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+// Debug builds replace the global operator new to count heap allocations, so the
+// per-frame count can be shown on screen. Define BRICKBREAKER_COUNT_ALLOCATIONS=0 to opt out,
+// or =1 to count in release builds too (the CMake COUNT_ALLOCATIONS option does, by default).
+#if !defined(BRICKBREAKER_COUNT_ALLOCATIONS)
+    #if defined(NDEBUG)
+        #define BRICKBREAKER_COUNT_ALLOCATIONS 0
+    #else
+        #define BRICKBREAKER_COUNT_ALLOCATIONS 1
+    #endif
+#endif
+
+// Total operator new calls since startup (always 0 when counting is compiled out)
+unsigned long long GetHeapAllocationCount();
+bool IsAllocationCountingCompiledIn();
+
+#endif // ALLOCATION_COUNTER_H
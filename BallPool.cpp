@@ -0,0 +1,219 @@
+#include "BallPool.h"
+
+// Pick the widest vector unit the compiler is allowed to use; the scalar loops
+// below also handle the tail that doesn't fill a whole register
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define BALL_POOL_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define BALL_POOL_SSE
+#endif
+
+int BallPool::Count() const {
+    return (int)x.size();
+}
+
+bool BallPool::Empty() const {
+    return x.empty();
+}
+
+int BallPool::Add(Vector2 pos, Vector2 spd, float rad, Color col) {
+    x.push_back(pos.x);
+    y.push_back(pos.y);
+    prevX.push_back(pos.x);
+    prevY.push_back(pos.y);
+    vx.push_back(spd.x);
+    vy.push_back(spd.y);
+    radius.push_back(rad);
+    active.push_back(1); // Ensure ball starts active
+    color.push_back(col);
+    return Count() - 1;
+}
+
+void BallPool::Clear() {
+    Truncate(0);
+}
+
+void BallPool::Truncate(int count) {
+    if (count >= Count()) return;
+    x.resize(count);
+    y.resize(count);
+    prevX.resize(count);
+    prevY.resize(count);
+    vx.resize(count);
+    vy.resize(count);
+    radius.resize(count);
+    active.resize(count);
+    color.resize(count);
+}
+
+Vector2 BallPool::GetPosition(int i) const {
+    return { x[i], y[i] };
+}
+
+Vector2 BallPool::GetSpeed(int i) const {
+    return { vx[i], vy[i] };
+}
+
+Vector2 BallPool::GetDrawPosition(int i, float alpha) const {
+    return {
+        prevX[i] + (x[i] - prevX[i]) * alpha,
+        prevY[i] + (y[i] - prevY[i]) * alpha
+    };
+}
+
+void BallPool::Integrate(float dt) {
+    const int count = Count();
+    float* px = x.data();
+    float* py = y.data();
+    float* ppx = prevX.data();
+    float* ppy = prevY.data();
+    const float* pvx = vx.data();
+    const float* pvy = vy.data();
+    int i = 0;
+
+#if defined(BALL_POOL_AVX)
+    const __m256 step = _mm256_set1_ps(dt);
+    for (; i + 8 <= count; i += 8) {
+        __m256 curX = _mm256_loadu_ps(px + i);
+        __m256 curY = _mm256_loadu_ps(py + i);
+        _mm256_storeu_ps(ppx + i, curX);
+        _mm256_storeu_ps(ppy + i, curY);
+        _mm256_storeu_ps(px + i, _mm256_add_ps(curX, _mm256_mul_ps(_mm256_loadu_ps(pvx + i), step)));
+        _mm256_storeu_ps(py + i, _mm256_add_ps(curY, _mm256_mul_ps(_mm256_loadu_ps(pvy + i), step)));
+    }
+#elif defined(BALL_POOL_SSE)
+    const __m128 step = _mm_set1_ps(dt);
+    for (; i + 4 <= count; i += 4) {
+        __m128 curX = _mm_loadu_ps(px + i);
+        __m128 curY = _mm_loadu_ps(py + i);
+        _mm_storeu_ps(ppx + i, curX);
+        _mm_storeu_ps(ppy + i, curY);
+        _mm_storeu_ps(px + i, _mm_add_ps(curX, _mm_mul_ps(_mm_loadu_ps(pvx + i), step)));
+        _mm_storeu_ps(py + i, _mm_add_ps(curY, _mm_mul_ps(_mm_loadu_ps(pvy + i), step)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        ppx[i] = px[i];
+        ppy[i] = py[i];
+        px[i] += pvx[i] * dt;
+        py[i] += pvy[i] * dt;
+    }
+}
+
+void BallPool::ReflectWalls(float fieldWidth, float fieldHeight) {
+    const int count = Count();
+    float* px = x.data();
+    float* py = y.data();
+    float* pvx = vx.data();
+    float* pvy = vy.data();
+    const float* pr = radius.data();
+    unsigned char* pactive = active.data();
+    int i = 0;
+
+    // Every lane follows the scalar rules at the bottom of this function: comparisons
+    // become masks, sign flips become XORs with -0.0f and the position fixes are blends.
+#if defined(BALL_POOL_AVX)
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 width = _mm256_set1_ps(fieldWidth);
+    const __m256 height = _mm256_set1_ps(fieldHeight);
+    const __m256 margin = _mm256_set1_ps(0.1f);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 bx = _mm256_loadu_ps(px + i);
+        __m256 by = _mm256_loadu_ps(py + i);
+        __m256 r = _mm256_loadu_ps(pr + i);
+
+        __m256 hitLeft = _mm256_cmp_ps(_mm256_sub_ps(bx, r), zero, _CMP_LE_OQ);
+        __m256 hitRight = _mm256_cmp_ps(_mm256_add_ps(bx, r), width, _CMP_GE_OQ);
+        __m256 flipX = _mm256_and_ps(_mm256_or_ps(hitLeft, hitRight), signBit);
+        _mm256_storeu_ps(pvx + i, _mm256_xor_ps(_mm256_loadu_ps(pvx + i), flipX));
+        bx = _mm256_blendv_ps(bx, _mm256_add_ps(r, margin), hitLeft);
+        hitRight = _mm256_cmp_ps(_mm256_add_ps(bx, r), width, _CMP_GE_OQ);
+        bx = _mm256_blendv_ps(bx, _mm256_sub_ps(_mm256_sub_ps(width, r), margin), hitRight);
+        _mm256_storeu_ps(px + i, bx);
+
+        __m256 hitTop = _mm256_cmp_ps(_mm256_sub_ps(by, r), zero, _CMP_LE_OQ);
+        _mm256_storeu_ps(pvy + i, _mm256_xor_ps(_mm256_loadu_ps(pvy + i), _mm256_and_ps(hitTop, signBit)));
+        by = _mm256_blendv_ps(by, _mm256_add_ps(r, margin), hitTop);
+        _mm256_storeu_ps(py + i, by);
+
+        int lost = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(by, r), height, _CMP_GE_OQ));
+        for (int lane = 0; lost != 0; ++lane, lost >>= 1) {
+            if (lost & 1) pactive[i + lane] = 0;
+        }
+    }
+#elif defined(BALL_POOL_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 width = _mm_set1_ps(fieldWidth);
+    const __m128 height = _mm_set1_ps(fieldHeight);
+    const __m128 margin = _mm_set1_ps(0.1f);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 bx = _mm_loadu_ps(px + i);
+        __m128 by = _mm_loadu_ps(py + i);
+        __m128 r = _mm_loadu_ps(pr + i);
+
+        __m128 hitLeft = _mm_cmple_ps(_mm_sub_ps(bx, r), zero);
+        __m128 hitRight = _mm_cmpge_ps(_mm_add_ps(bx, r), width);
+        __m128 flipX = _mm_and_ps(_mm_or_ps(hitLeft, hitRight), signBit);
+        _mm_storeu_ps(pvx + i, _mm_xor_ps(_mm_loadu_ps(pvx + i), flipX));
+        // SSE2 has no blendv: select with and/andnot/or
+        bx = _mm_or_ps(_mm_and_ps(hitLeft, _mm_add_ps(r, margin)), _mm_andnot_ps(hitLeft, bx));
+        hitRight = _mm_cmpge_ps(_mm_add_ps(bx, r), width);
+        bx = _mm_or_ps(_mm_and_ps(hitRight, _mm_sub_ps(_mm_sub_ps(width, r), margin)), _mm_andnot_ps(hitRight, bx));
+        _mm_storeu_ps(px + i, bx);
+
+        __m128 hitTop = _mm_cmple_ps(_mm_sub_ps(by, r), zero);
+        _mm_storeu_ps(pvy + i, _mm_xor_ps(_mm_loadu_ps(pvy + i), _mm_and_ps(hitTop, signBit)));
+        by = _mm_or_ps(_mm_and_ps(hitTop, _mm_add_ps(r, margin)), _mm_andnot_ps(hitTop, by));
+        _mm_storeu_ps(py + i, by);
+
+        int lost = _mm_movemask_ps(_mm_cmpge_ps(_mm_add_ps(by, r), height));
+        for (int lane = 0; lost != 0; ++lane, lost >>= 1) {
+            if (lost & 1) pactive[i + lane] = 0;
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        // Ball vs Walls Collision
+        if (px[i] - pr[i] <= 0 || px[i] + pr[i] >= fieldWidth) {
+            pvx[i] *= -1.0f;
+            if (px[i] - pr[i] <= 0) px[i] = pr[i] + 0.1f;
+            if (px[i] + pr[i] >= fieldWidth) px[i] = fieldWidth - pr[i] - 0.1f;
+        }
+        if (py[i] - pr[i] <= 0) {
+            pvy[i] *= -1.0f;
+            py[i] = pr[i] + 0.1f;
+        }
+
+        // Ball vs Bottom Edge
+        if (py[i] + pr[i] >= fieldHeight) {
+            pactive[i] = 0;
+        }
+    }
+}
+
+void BallPool::RemoveInactive() {
+    const int count = Count();
+    int kept = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!active[i]) continue;
+        if (kept != i) {
+            x[kept] = x[i];
+            y[kept] = y[i];
+            prevX[kept] = prevX[i];
+            prevY[kept] = prevY[i];
+            vx[kept] = vx[i];
+            vy[kept] = vy[i];
+            radius[kept] = radius[i];
+            active[kept] = active[i];
+            color[kept] = color[i];
+        }
+        kept++;
+    }
+    Truncate(kept);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#ifndef BALL_POOL_H
+#define BALL_POOL_H
+
+#include "raylib.h" // For Vector2, Color (types only)
+#include <vector>
+
+//------------------------------------------------------------------------------------
+// Structure-of-arrays ball storage
+// Every ball attribute lives in its own contiguous array so integration and wall
+// response can process 4 (SSE) or 8 (AVX) balls per instruction. Index i across all
+// arrays is ball i.
+//------------------------------------------------------------------------------------
+class BallPool {
+public:
+    std::vector<float> x, y;         // Position
+    std::vector<float> prevX, prevY; // Position at the start of the last tick, used for render interpolation
+    std::vector<float> vx, vy;       // Speed (px/s)
+    std::vector<float> radius;
+    std::vector<unsigned char> active;
+    std::vector<Color> color;
+
+    int Count() const;
+    bool Empty() const;
+    int Add(Vector2 pos, Vector2 spd, float rad, Color col = WHITE); // Returns the new ball's index
+    void Clear();
+    void Truncate(int count); // Keep only the first 'count' balls
+
+    Vector2 GetPosition(int i) const;
+    Vector2 GetSpeed(int i) const;
+    Vector2 GetDrawPosition(int i, float alpha) const; // alpha: fraction of a tick elapsed since the last update
+
+    // Bulk kernels, SIMD when the compiler targets SSE2/AVX, scalar otherwise
+    void Integrate(float dt);                                // prev = pos, pos += speed * dt
+    void ReflectWalls(float fieldWidth, float fieldHeight);  // Bounce off sides/top, deactivate below the bottom
+    void RemoveInactive();                                   // Compacts the arrays, keeping ball order
+};
+
+#endif // BALL_POOL_H
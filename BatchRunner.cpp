@@ -0,0 +1,129 @@
+#include "BatchRunner.h"
+#include "ThreadPool.h"
+#include <algorithm> // For std::sort, std::min
+#include <chrono>
+
+BatchConfig DefaultBatchConfig() {
+    BatchConfig config;
+    config.sim = DefaultSimConfig();
+    config.bot = DefaultBotConfig();
+    config.games = 1000;
+    config.firstSeed = 1;
+    config.maxGameTime = 600.0f;
+    config.threads = 0;
+    config.gamesPerTask = 8;
+    return config;
+}
+
+GameResult RunBotGame(const SimConfig& simConfig, const BotConfig& botConfig, unsigned int seed, float maxGameTime) {
+    Simulation simulation;
+    simulation.Init(seed, simConfig);
+    SimBot bot;
+    bot.Init(botConfig, seed);
+
+    GameResult result;
+    result.seed = seed;
+    result.firstClearTime = -1.0f;
+    result.levelsCleared = 0;
+    result.ballsLost = 0;
+    result.modifiersCollected = 0;
+    result.ticks = 0;
+
+    const unsigned long long maxTicks = (unsigned long long)(maxGameTime * SIM_TICK_RATE);
+    while (!simulation.gameOver && result.ticks < maxTicks) {
+        simulation.Step(bot.Think(simulation), SIM_DT);
+        result.ticks++;
+
+        for (const SimEvent& event : simulation.events) {
+            switch (event.type) {
+            case SIM_EVENT_LEVEL_CLEARED:
+                if (result.levelsCleared == 0) result.firstClearTime = simulation.gameTimer;
+                result.levelsCleared++;
+                break;
+            case SIM_EVENT_BALL_LOST: result.ballsLost++; break;
+            case SIM_EVENT_MODIFIER_COLLECTED: result.modifiersCollected++; break;
+            default: break;
+            }
+        }
+    }
+
+    result.score = simulation.score;
+    result.duration = simulation.gameTimer;
+    result.gameOver = simulation.gameOver;
+    return result;
+}
+
+// Nearest-rank percentile of an ascending array
+template <typename T>
+static T Percentile(const std::vector<T>& sorted, double p) {
+    size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+BatchStats RunBatch(const BatchConfig& config, std::vector<GameResult>* results) {
+    std::vector<GameResult> games(config.games > 0 ? config.games : 0);
+    const int chunk = config.gamesPerTask > 0 ? config.gamesPerTask : 1;
+
+    BatchStats stats = {};
+    auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(config.threads);
+        stats.threads = pool.GetThreadCount();
+
+        // Each task writes its own slice of games, no locking needed
+        for (int first = 0; first < (int)games.size(); first += chunk) {
+            int last = std::min(first + chunk, (int)games.size());
+            pool.Submit([&config, &games, first, last] {
+                for (int i = first; i < last; ++i) {
+                    games[i] = RunBotGame(config.sim, config.bot, config.firstSeed + (unsigned int)i, config.maxGameTime);
+                }
+            });
+        }
+        pool.Wait();
+    }
+    stats.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    stats.games = (int)games.size();
+    if (games.empty()) return stats;
+
+    std::vector<int> scores;
+    std::vector<float> firstClears;
+    scores.reserve(games.size());
+    double scoreSum = 0.0, clearSum = 0.0, levelsSum = 0.0, lostSum = 0.0, modifiersSum = 0.0, durationSum = 0.0;
+    for (const GameResult& game : games) {
+        stats.ticks += game.ticks;
+        if (game.gameOver) stats.gamesOver++;
+        scores.push_back(game.score);
+        scoreSum += game.score;
+        if (game.levelsCleared > 0) {
+            firstClears.push_back(game.firstClearTime);
+            clearSum += game.firstClearTime;
+        }
+        levelsSum += game.levelsCleared;
+        lostSum += game.ballsLost;
+        modifiersSum += game.modifiersCollected;
+        durationSum += game.duration;
+    }
+
+    std::sort(scores.begin(), scores.end());
+    stats.scoreMean = scoreSum / games.size();
+    stats.scoreMin = scores.front();
+    stats.scoreP10 = Percentile(scores, 0.10);
+    stats.scoreP50 = Percentile(scores, 0.50);
+    stats.scoreP90 = Percentile(scores, 0.90);
+    stats.scoreMax = scores.back();
+
+    stats.gamesWithClear = (int)firstClears.size();
+    if (!firstClears.empty()) {
+        std::sort(firstClears.begin(), firstClears.end());
+        stats.firstClearMean = clearSum / firstClears.size();
+        stats.firstClearP50 = Percentile(firstClears, 0.50);
+    }
+    stats.levelsClearedMean = levelsSum / games.size();
+    stats.ballsLostMean = lostSum / games.size();
+    stats.modifiersMean = modifiersSum / games.size();
+    stats.durationMean = durationSum / games.size();
+
+    if (results != nullptr) results->swap(games);
+    return stats;
+}
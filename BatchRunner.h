@@ -0,0 +1,64 @@
+#pragma once
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <vector>
+#include "Simulation.h"
+#include "SimBot.h"
+
+//------------------------------------------------------------------------------------
+// Headless batch simulation for balance tuning
+// Plays many independent bot games with the same SimConfig, spread over a work-stealing
+// thread pool, and reduces them to aggregate stats. Game i uses seed firstSeed + i, so a
+// batch gives the same numbers whatever the thread count, and any single game can be
+// rerun (or recorded) on its own.
+//------------------------------------------------------------------------------------
+struct BatchConfig {
+    SimConfig sim;
+    BotConfig bot;
+    int games;
+    unsigned int firstSeed;
+    float maxGameTime;   // Game seconds before a round is cut off (a bot can keep going forever)
+    int threads;         // 0: one per hardware thread
+    int gamesPerTask;    // Games a worker takes at once, amortizes scheduling
+};
+
+BatchConfig DefaultBatchConfig();
+
+struct GameResult {
+    unsigned int seed;
+    int score;
+    float duration;        // Game seconds played
+    float firstClearTime;  // Game seconds until the first level was cleared, negative if never
+    int levelsCleared;
+    int ballsLost;
+    int modifiersCollected;
+    unsigned long long ticks;
+    bool gameOver;         // False if the round hit maxGameTime
+};
+
+struct BatchStats {
+    int games;
+    int gamesOver;              // Ended by losing every ball (the rest were cut off)
+    unsigned long long ticks;
+    double wallSeconds;
+    int threads;
+
+    double scoreMean;
+    int scoreMin, scoreP10, scoreP50, scoreP90, scoreMax;
+
+    int gamesWithClear;
+    double firstClearMean;      // Over games that cleared at least one level
+    double firstClearP50;
+    double levelsClearedMean;
+    double ballsLostMean;
+    double modifiersMean;
+    double durationMean;
+};
+
+GameResult RunBotGame(const SimConfig& simConfig, const BotConfig& botConfig, unsigned int seed, float maxGameTime);
+
+// Plays config.games games in parallel; results (indexed by game) is optional
+BatchStats RunBatch(const BatchConfig& config, std::vector<GameResult>* results = nullptr);
+
+#endif // BATCH_RUNNER_H
@@ -0,0 +1,50 @@
+#ifndef BIT_OPS_H
+#define BIT_OPS_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+//------------------------------------------------------------------------------------
+// Portable 64-bit popcount / count-trailing-zeros, 32-bit highest set bit
+//------------------------------------------------------------------------------------
+inline int PopCount64(uint64_t bits) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    return (int)__popcnt64(bits);
+#elif defined(_MSC_VER)
+    return (int)(__popcnt((unsigned int)bits) + __popcnt((unsigned int)(bits >> 32)));
+#else
+    return __builtin_popcountll(bits);
+#endif
+}
+
+// Index of the lowest set bit, bits must not be 0
+inline int CountTrailingZeros64(uint64_t bits) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return (int)index;
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long)bits)) return (int)index;
+    _BitScanForward(&index, (unsigned long)(bits >> 32));
+    return (int)index + 32;
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+// Index of the highest set bit, bits must not be 0
+inline int HighestSetBit32(uint32_t bits) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, (unsigned long)bits);
+    return (int)index;
+#else
+    return 31 - __builtin_clz(bits);
+#endif
+}
+
+#endif // BIT_OPS_H
@@ -0,0 +1,80 @@
+#include "BoardCache.h"
+#include "Constants.h"
+#include "rlgl.h" // For rlSetBlendFactors, rlFramebufferComplete
+#include <cmath>
+
+BoardCache::BoardCache() : target(), originX(0.0f), originY(0.0f), rows(0), cols(0), tooLarge(false) {}
+
+bool BoardCache::Rebuild(const BrickField& field) {
+    Unload();
+    rows = field.GetRows();
+    cols = field.GetCols();
+    tooLarge = false;
+    if (rows == 0 || cols == 0) return true;
+
+    // Whole-pixel bounds of the lattice
+    const BrickGrid& grid = field.GetGrid();
+    Rectangle last = grid.GetCellRect(rows - 1, cols - 1);
+    originX = floorf(grid.originX);
+    originY = floorf(grid.originY);
+    int width = (int)ceilf(last.x + last.width - originX);
+    int height = (int)ceilf(last.y + last.height - originY);
+
+    if (width > BOARD_CACHE_MAX_TEXTURE_SIZE || height > BOARD_CACHE_MAX_TEXTURE_SIZE) {
+        tooLarge = true;
+        return false;
+    }
+    target = LoadRenderTexture(width, height);
+    if (target.id == 0 || !rlFramebufferComplete(target.id)) {
+        if (target.id != 0) UnloadRenderTexture(target);
+        target = RenderTexture2D();
+        tooLarge = true;
+        return false;
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    EndTextureMode();
+    return true;
+}
+
+bool BoardCache::Sync(BrickField& field) {
+    if (field.GetRows() != rows || field.GetCols() != cols) {
+        if (!Rebuild(field)) return false;
+    }
+    if (tooLarge) return false;
+    if (field.GetDirtyCount() == 0 || target.id == 0) {
+        field.ClearDirty();
+        return true;
+    }
+
+    // Overwrite instead of blending so dead cells go back to transparent
+    BeginTextureMode(target);
+    rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM);
+    field.ForEachDirty([&](int row, int col) {
+        Rectangle rect = field.GetBrickRect(row, col);
+        rect.x -= originX;
+        rect.y -= originY;
+        DrawRectangleRec(rect, field.GetBrickColor(row, col));
+    });
+    EndBlendMode();
+    EndTextureMode();
+
+    field.ClearDirty();
+    return true;
+}
+
+void BoardCache::Draw() const {
+    if (target.id == 0) return;
+    // Render textures are stored bottom-up, flip with a negative source height
+    Rectangle source = { 0.0f, 0.0f, (float)target.texture.width, -(float)target.texture.height };
+    DrawTextureRec(target.texture, source, { originX, originY }, WHITE);
+}
+
+void BoardCache::Unload() {
+    if (target.id != 0) UnloadRenderTexture(target);
+    target = RenderTexture2D();
+    rows = 0;
+    cols = 0;
+}
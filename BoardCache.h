@@ -0,0 +1,33 @@
+#pragma once
+#ifndef BOARD_CACHE_H
+#define BOARD_CACHE_H
+
+#include "raylib.h"
+#include "BrickField.h"
+
+//------------------------------------------------------------------------------------
+// Brick field pre-rasterized into a render texture
+// The board only changes when a brick is hit, so instead of resubmitting every brick
+// each frame we keep its image and repaint just the dirty cells (replace blending, so a
+// destroyed brick is cleared to transparent). Drawing is then one textured quad.
+//------------------------------------------------------------------------------------
+class BoardCache {
+public:
+    BoardCache();
+
+    // Repaints dirty cells and clears the field's dirty set. Returns false (leaving the
+    // dirty set alone) when the board doesn't fit in a texture, the caller draws it instead.
+    bool Sync(BrickField& field);
+    void Draw() const;
+    void Unload();
+
+private:
+    bool Rebuild(const BrickField& field);
+
+    RenderTexture2D target;
+    float originX, originY;  // Screen position of the texture's top-left pixel
+    int rows, cols;          // Layout the texture was built for
+    bool tooLarge;           // Layout doesn't fit, Sync() keeps failing until it changes
+};
+
+#endif // BOARD_CACHE_H
@@ -0,0 +1,148 @@
+#include "BrickField.h"
+#include <algorithm> // For std::fill
+
+BrickField::BrickField() : wordsPerRow(0), liveCount(0), dirtyCount(0) {}
+
+void BrickField::Init(int rows, int cols, float originX, float originY, float brickWidth, float brickHeight, float gap) {
+    grid.Init(originX, originY, brickWidth, brickHeight, gap, rows, cols);
+    lives.assign((std::size_t)rows * cols, 0);
+    wordsPerRow = (cols + 63) / 64;
+    liveBits.assign((std::size_t)rows * wordsPerRow, 0);
+    liveCount = 0;
+
+    // Layout changed, everything needs redrawing
+    dirtyBits.assign((std::size_t)rows * wordsPerRow, 0);
+    dirtyCount = 0;
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) MarkDirty(r, c);
+    }
+}
+
+int BrickField::GetRows() const {
+    return grid.rows;
+}
+
+int BrickField::GetCols() const {
+    return grid.cols;
+}
+
+const BrickGrid& BrickField::GetGrid() const {
+    return grid;
+}
+
+int BrickField::GetLives(int row, int col) const {
+    return lives[(std::size_t)row * grid.cols + col];
+}
+
+void BrickField::SetLives(int row, int col, int lvs) {
+    unsigned char& cell = lives[(std::size_t)row * grid.cols + col];
+    const unsigned char newLives = (unsigned char)(lvs > 255 ? 255 : (lvs < 0 ? 0 : lvs));
+    if (newLives == cell) return;
+    if (cell > 0) liveCount--;
+    cell = newLives;
+    if (cell > 0) liveCount++;
+    SetLiveBit(row, col, cell > 0);
+    MarkDirty(row, col);
+}
+
+bool BrickField::IsDestroyed(int row, int col) const {
+    return lives[(std::size_t)row * grid.cols + col] == 0;
+}
+
+int BrickField::Hit(int row, int col) {
+    unsigned char& cell = lives[(std::size_t)row * grid.cols + col];
+    if (cell > 0) {
+        cell--;
+        MarkDirty(row, col);
+        if (cell == 0) {
+            liveCount--;
+            SetLiveBit(row, col, false);
+        }
+    }
+    return cell;
+}
+
+int BrickField::GetLiveCount() const {
+    return liveCount;
+}
+
+bool BrickField::AnyLive() const {
+    return liveCount > 0;
+}
+
+int BrickField::CountLive() const {
+    int count = 0;
+    for (uint64_t word : liveBits) count += PopCount64(word);
+    return count;
+}
+
+int BrickField::GetRowLiveCount(int row) const {
+    const uint64_t* words = &liveBits[(std::size_t)row * wordsPerRow];
+    int count = 0;
+    for (int w = 0; w < wordsPerRow; ++w) count += PopCount64(words[w]);
+    return count;
+}
+
+int BrickField::GetColumnLiveCount(int col) const {
+    const uint64_t mask = 1ULL << (col & 63);
+    int count = 0;
+    for (int r = 0; r < grid.rows; ++r) {
+        if (liveBits[(std::size_t)r * wordsPerRow + (col >> 6)] & mask) count++;
+    }
+    return count;
+}
+
+int BrickField::FindNextLive(int row, int col) const {
+    if (col >= grid.cols) return -1;
+    const uint64_t* words = &liveBits[(std::size_t)row * wordsPerRow];
+    int w = col >> 6;
+    uint64_t bits = words[w] & (~0ULL << (col & 63));
+    while (true) {
+        if (bits != 0) return w * 64 + CountTrailingZeros64(bits);
+        if (++w >= wordsPerRow) return -1;
+        bits = words[w];
+    }
+}
+
+void BrickField::SetLiveBit(int row, int col, bool alive) {
+    uint64_t& word = liveBits[(std::size_t)row * wordsPerRow + (col >> 6)];
+    const uint64_t mask = 1ULL << (col & 63);
+    if (alive) word |= mask;
+    else word &= ~mask;
+}
+
+int BrickField::GetDirtyCount() const {
+    return dirtyCount;
+}
+
+void BrickField::ClearDirty() {
+    if (dirtyCount == 0) return;
+    std::fill(dirtyBits.begin(), dirtyBits.end(), 0);
+    dirtyCount = 0;
+}
+
+void BrickField::MarkDirty(int row, int col) {
+    uint64_t& word = dirtyBits[(std::size_t)row * wordsPerRow + (col >> 6)];
+    const uint64_t mask = 1ULL << (col & 63);
+    if ((word & mask) == 0) {
+        word |= mask;
+        dirtyCount++;
+    }
+}
+
+Rectangle BrickField::GetBrickRect(int row, int col) const {
+    return grid.GetCellRect(row, col);
+}
+
+Vector2 BrickField::GetBrickCenter(int row, int col) const {
+    Rectangle rect = grid.GetCellRect(row, col);
+    return { rect.x + rect.width / 2, rect.y + rect.height / 2 };
+}
+
+Color BrickField::GetBrickColor(int row, int col) const {
+    int lvs = GetLives(row, col);
+    if (lvs >= 3) return MAROON;
+    else if (lvs == 2) return RED;
+    else if (lvs == 1) return ORANGE;
+    return BLANK; // Destroyed bricks aren't drawn
+}
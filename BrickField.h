@@ -0,0 +1,104 @@
+#pragma once
+#ifndef BRICK_FIELD_H
+#define BRICK_FIELD_H
+
+#include "raylib.h" // For Rectangle, Vector2, Color (types only)
+#include <vector>
+#include <cstddef> // For size_t
+#include <cstdint>
+#include "BitOps.h"
+#include "BrickGrid.h"
+
+//------------------------------------------------------------------------------------
+// Runtime-sized field of bricks
+// Bricks on a regular lattice only differ by their remaining lives, so that's all we store:
+// one byte per cell in a contiguous row-major array. Position and colour are derived.
+// A packed bitset (one bit per brick, each row padded to whole 64-bit words) mirrors which
+// bricks are still alive so callers can skip dead regions a word at a time.
+// A second bitset of the same shape records which cells changed since the last
+// ClearDirty(), so renderers can re-upload only what a hit touched.
+//------------------------------------------------------------------------------------
+class BrickField {
+public:
+    BrickField();
+
+    // Lays out a rows x cols lattice starting at (originX, originY), every brick dead
+    void Init(int rows, int cols, float originX, float originY, float brickWidth, float brickHeight, float gap);
+
+    int GetRows() const;
+    int GetCols() const;
+    const BrickGrid& GetGrid() const;
+
+    int GetLives(int row, int col) const;
+    void SetLives(int row, int col, int lives);
+    bool IsDestroyed(int row, int col) const;
+    int Hit(int row, int col); // Removes one life, returns the lives left
+    int GetLiveCount() const;  // Bricks with lives left, kept up to date on every change
+    bool AnyLive() const;
+
+    // Bitset queries
+    int CountLive() const;                  // Popcount over the whole mask
+    int GetRowLiveCount(int row) const;
+    int GetColumnLiveCount(int col) const;
+    int FindNextLive(int row, int col) const; // First live column >= col in row, or -1
+
+    // Calls visit(col) for every live brick of row in [colMin, colMax], left to right
+    template <typename Visitor>
+    void ForEachLiveInRow(int row, int colMin, int colMax, Visitor visit) const;
+
+    // Change tracking: every cell whose lives changed (Init marks the whole field)
+    int GetDirtyCount() const;
+    template <typename Visitor>
+    void ForEachDirty(Visitor visit) const; // visit(row, col), row-major order
+    void ClearDirty();
+
+    Rectangle GetBrickRect(int row, int col) const;
+    Vector2 GetBrickCenter(int row, int col) const;
+    Color GetBrickColor(int row, int col) const;
+
+private:
+    BrickGrid grid;
+    std::vector<unsigned char> lives; // rows * cols, row-major
+    std::vector<uint64_t> liveBits;   // rows * wordsPerRow, bit c of a row set while brick c is alive
+    std::vector<uint64_t> dirtyBits;  // Same layout as liveBits
+    int wordsPerRow;
+    int liveCount;
+    int dirtyCount;
+
+    void SetLiveBit(int row, int col, bool alive);
+    void MarkDirty(int row, int col);
+};
+
+template <typename Visitor>
+void BrickField::ForEachLiveInRow(int row, int colMin, int colMax, Visitor visit) const {
+    if (colMin > colMax) return;
+    const uint64_t* words = &liveBits[(std::size_t)row * wordsPerRow];
+    const int firstWord = colMin >> 6;
+    const int lastWord = colMax >> 6;
+    for (int w = firstWord; w <= lastWord; ++w) {
+        uint64_t bits = words[w];
+        if (w == firstWord) bits &= ~0ULL << (colMin & 63);
+        if (w == lastWord) bits &= ~0ULL >> (63 - (colMax & 63));
+        while (bits != 0) {
+            visit(w * 64 + CountTrailingZeros64(bits));
+            bits &= bits - 1; // Clear the lowest set bit
+        }
+    }
+}
+
+template <typename Visitor>
+void BrickField::ForEachDirty(Visitor visit) const {
+    if (dirtyCount == 0) return;
+    for (int r = 0; r < grid.rows; ++r) {
+        const uint64_t* words = &dirtyBits[(std::size_t)r * wordsPerRow];
+        for (int w = 0; w < wordsPerRow; ++w) {
+            uint64_t bits = words[w];
+            while (bits != 0) {
+                visit(r, w * 64 + CountTrailingZeros64(bits));
+                bits &= bits - 1;
+            }
+        }
+    }
+}
+
+#endif // BRICK_FIELD_H
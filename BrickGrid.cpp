@@ -0,0 +1,35 @@
+#include "BrickGrid.h"
+#include <cmath> // For floorf
+
+BrickGrid::BrickGrid() : originX(0.0f), originY(0.0f), pitchX(1.0f), pitchY(1.0f), brickWidth(0.0f), brickHeight(0.0f), rows(0), cols(0) {}
+
+void BrickGrid::Init(float oX, float oY, float bWidth, float bHeight, float gap, int numRows, int numCols) {
+    originX = oX;
+    originY = oY;
+    brickWidth = bWidth;
+    brickHeight = bHeight;
+    pitchX = bWidth + gap;
+    pitchY = bHeight + gap;
+    rows = numRows;
+    cols = numCols;
+}
+
+bool BrickGrid::QueryCells(Rectangle box, CellRange* range) const {
+    // Each cell owns its brick plus the gap after it, so floor() gives the first/last cell touched
+    int colMin = (int)floorf((box.x - originX) / pitchX);
+    int colMax = (int)floorf((box.x + box.width - originX) / pitchX);
+    int rowMin = (int)floorf((box.y - originY) / pitchY);
+    int rowMax = (int)floorf((box.y + box.height - originY) / pitchY);
+
+    if (colMax < 0 || rowMax < 0 || colMin >= cols || rowMin >= rows) return false;
+
+    range->colMin = colMin < 0 ? 0 : colMin;
+    range->colMax = colMax >= cols ? cols - 1 : colMax;
+    range->rowMin = rowMin < 0 ? 0 : rowMin;
+    range->rowMax = rowMax >= rows ? rows - 1 : rowMax;
+    return true;
+}
+
+Rectangle BrickGrid::GetCellRect(int row, int col) const {
+    return { originX + col * pitchX, originY + row * pitchY, brickWidth, brickHeight };
+}
@@ -0,0 +1,31 @@
+#ifndef BRICK_GRID_H
+#define BRICK_GRID_H
+
+#include "raylib.h" // For Rectangle (type only)
+
+//------------------------------------------------------------------------------------
+// Uniform grid over the brick lattice
+// Bricks sit at origin + (col, row) * pitch, so the cells a box can touch are found
+// with a couple of divisions instead of testing every brick.
+//------------------------------------------------------------------------------------
+struct CellRange {
+    int rowMin, rowMax; // Inclusive
+    int colMin, colMax; // Inclusive
+};
+
+class BrickGrid {
+public:
+    float originX, originY;        // Top-left corner of brick (0, 0)
+    float pitchX, pitchY;          // Distance between neighbouring bricks (size + gap)
+    float brickWidth, brickHeight;
+    int rows, cols;
+
+    BrickGrid();
+
+    void Init(float oX, float oY, float bWidth, float bHeight, float gap, int numRows, int numCols);
+    // Cells overlapped by the box, clamped to the grid. Returns false if the box misses the grid.
+    bool QueryCells(Rectangle box, CellRange* range) const;
+    Rectangle GetCellRect(int row, int col) const;
+};
+
+#endif // BRICK_GRID_H
@@ -0,0 +1,126 @@
+#include "BrickRenderer.h"
+#include "rlgl.h"
+#include "raymath.h" // For MatrixMultiply
+
+BrickRenderer::BrickRenderer() : vaoId(0), vboId(0), rows(0), cols(0) {}
+
+void BrickRenderer::WriteCell(const BrickField& field, int row, int col) {
+    BrickVertex* v = &vertices[((std::size_t)row * cols + col) * VERTICES_PER_BRICK];
+    if (field.IsDestroyed(row, col)) {
+        for (int i = 0; i < VERTICES_PER_BRICK; ++i) v[i] = { 0.0f, 0.0f, 0, 0, 0, 0 };
+        return;
+    }
+
+    Rectangle rect = field.GetBrickRect(row, col);
+    Color color = field.GetBrickColor(row, col);
+    const float left = rect.x, top = rect.y;
+    const float right = rect.x + rect.width, bottom = rect.y + rect.height;
+
+    // Counter-clockwise in screen space, same winding as rlgl's own quads
+    v[0] = { left, top, color.r, color.g, color.b, color.a };
+    v[1] = { left, bottom, color.r, color.g, color.b, color.a };
+    v[2] = { right, bottom, color.r, color.g, color.b, color.a };
+    v[3] = { left, top, color.r, color.g, color.b, color.a };
+    v[4] = { right, bottom, color.r, color.g, color.b, color.a };
+    v[5] = { right, top, color.r, color.g, color.b, color.a };
+}
+
+void BrickRenderer::BindAttributes() const {
+    int* locs = rlGetShaderLocsDefault();
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, false, sizeof(BrickVertex), (void*)0);
+    rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, true, sizeof(BrickVertex), (void*)(2 * sizeof(float)));
+    rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+
+void BrickRenderer::Load(const BrickField& field) {
+    Unload();
+    rows = field.GetRows();
+    cols = field.GetCols();
+    vertices.assign((std::size_t)rows * cols * VERTICES_PER_BRICK, BrickVertex{ 0.0f, 0.0f, 0, 0, 0, 0 });
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) WriteCell(field, r, c);
+    }
+    if (vertices.empty()) return;
+
+    // VAO is optional (GL 2.1 without the extension), Draw() binds attributes by hand then
+    vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(vaoId);
+    vboId = rlLoadVertexBuffer(vertices.data(), (int)(vertices.size() * sizeof(BrickVertex)), true);
+    BindAttributes();
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+}
+
+void BrickRenderer::Unload() {
+    if (vboId != 0) rlUnloadVertexBuffer(vboId);
+    if (vaoId != 0) rlUnloadVertexArray(vaoId);
+    vaoId = 0;
+    vboId = 0;
+}
+
+void BrickRenderer::UploadCells(int firstCell, int cellCount) const {
+    const std::size_t first = (std::size_t)firstCell * VERTICES_PER_BRICK;
+    rlUpdateVertexBuffer(vboId, &vertices[first], cellCount * VERTICES_PER_BRICK * (int)sizeof(BrickVertex),
+        (int)(first * sizeof(BrickVertex)));
+}
+
+void BrickRenderer::Sync(BrickField& field) {
+    if (field.GetRows() != rows || field.GetCols() != cols || vboId == 0) {
+        Load(field);
+        field.ClearDirty();
+        return;
+    }
+    if (field.GetDirtyCount() == 0) return;
+
+    // Rewrite the dirty cells and upload each run of consecutive ones with a single call
+    int runStart = -1;
+    int runEnd = -1;
+    field.ForEachDirty([&](int row, int col) {
+        WriteCell(field, row, col);
+        const int cell = row * cols + col;
+        if (cell != runEnd) {
+            if (runStart >= 0) UploadCells(runStart, runEnd - runStart);
+            runStart = cell;
+        }
+        runEnd = cell + 1;
+    });
+    if (runStart >= 0) UploadCells(runStart, runEnd - runStart);
+    field.ClearDirty();
+}
+
+void BrickRenderer::Draw() const {
+    if (vboId == 0) return;
+
+    rlDrawRenderBatchActive(); // Keep ordering with whatever was batched before us
+
+    unsigned int shaderId = rlGetShaderIdDefault();
+    int* locs = rlGetShaderLocsDefault();
+    rlEnableShader(shaderId);
+
+    Matrix mvp = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+    rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], mvp);
+    const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+
+    // No texcoord stream: the constant (0,0) samples the 1x1 white default texture
+    const float zero[2] = { 0.0f, 0.0f };
+    rlActiveTextureSlot(0);
+    rlEnableTexture(rlGetTextureIdDefault());
+    const int textureSlot = 0;
+    rlSetUniform(locs[RL_SHADER_LOC_MAP_DIFFUSE], &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+
+    if (!rlEnableVertexArray(vaoId)) {
+        rlEnableVertexBuffer(vboId);
+        BindAttributes();
+        rlDisableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    }
+    rlSetVertexAttributeDefault(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], zero, RL_SHADER_ATTRIB_VEC2, 2);
+
+    rlDrawVertexArray(0, (int)vertices.size());
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableTexture();
+    rlDisableShader();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef BRICK_RENDERER_H
+#define BRICK_RENDERER_H
+
+#include "raylib.h"
+#include "BrickField.h"
+#include <vector>
+
+//------------------------------------------------------------------------------------
+// Whole brick field in one GPU vertex buffer
+// Each cell owns 6 vertices (two triangles) at a fixed offset, dead cells are collapsed
+// to a degenerate point. Sync() rewrites only the cells the field marked dirty, and
+// Draw() submits the board with a single glDrawArrays regardless of its size, bypassing
+// the rlgl immediate-mode batch (and its RL_DEFAULT_BATCH_BUFFER_ELEMENTS flushes).
+//------------------------------------------------------------------------------------
+class BrickRenderer {
+public:
+    BrickRenderer();
+
+    void Sync(BrickField& field); // Uploads dirty cells (rebuilds on layout change), clears the field's dirty set
+    void Draw() const;            // Needs an active BeginDrawing()/BeginTextureMode()
+    void Unload();
+
+    bool IsReady() const { return vboId != 0; }
+
+private:
+    struct BrickVertex {
+        float x, y;
+        unsigned char r, g, b, a;
+    };
+    static const int VERTICES_PER_BRICK = 6;
+
+    void Load(const BrickField& field);
+    void WriteCell(const BrickField& field, int row, int col);
+    void UploadCells(int firstCell, int cellCount) const;
+    void BindAttributes() const;
+
+    std::vector<BrickVertex> vertices; // CPU mirror of the GPU buffer
+    unsigned int vaoId;
+    unsigned int vboId;
+    int rows;
+    int cols;
+};
+
+#endif // BRICK_RENDERER_H
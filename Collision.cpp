@@ -0,0 +1,144 @@
+#include "Collision.h"
+#include <cmath> // For fabsf, sqrtf
+
+// Mirrors CheckCollisionCircleRec (rshapes.c), including its integer-rounded rectangle centre
+bool CircleIntersectsRect(Vector2 center, float radius, Rectangle rec) {
+    int recCenterX = (int)(rec.x + rec.width / 2.0f);
+    int recCenterY = (int)(rec.y + rec.height / 2.0f);
+
+    float dx = fabsf(center.x - (float)recCenterX);
+    float dy = fabsf(center.y - (float)recCenterY);
+
+    if (dx > (rec.width / 2.0f + radius)) return false;
+    if (dy > (rec.height / 2.0f + radius)) return false;
+
+    if (dx <= (rec.width / 2.0f)) return true;
+    if (dy <= (rec.height / 2.0f)) return true;
+
+    float cornerDistanceSq = (dx - rec.width / 2.0f) * (dx - rec.width / 2.0f) +
+                             (dy - rec.height / 2.0f) * (dy - rec.height / 2.0f);
+
+    return cornerDistanceSq <= (radius * radius);
+}
+
+// Mirrors CheckCollisionRecs (rshapes.c)
+bool RectsIntersect(Rectangle rec1, Rectangle rec2) {
+    return (rec1.x < (rec2.x + rec2.width) && (rec1.x + rec1.width) > rec2.x) &&
+           (rec1.y < (rec2.y + rec2.height) && (rec1.y + rec1.height) > rec2.y);
+}
+
+// Segment (origin + t * dir, t in [0, 1]) against an axis-aligned box, slab method.
+// Only entries from outside count; a segment starting inside the box reports no hit.
+static bool SegmentEntersBox(Vector2 origin, Vector2 dir, float minX, float minY, float maxX, float maxY, float* tHit, Vector2* normal) {
+    float tEnter = 0.0f;
+    float tExit = 1.0f;
+    Vector2 enterNormal = { 0.0f, 0.0f };
+    bool entered = false;
+
+    // X slab
+    if (fabsf(dir.x) < 1e-8f) {
+        if (origin.x <= minX || origin.x >= maxX) return false;
+    }
+    else {
+        float t1 = (minX - origin.x) / dir.x;
+        float t2 = (maxX - origin.x) / dir.x;
+        if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+        if (t1 >= tEnter) { tEnter = t1; enterNormal = { dir.x > 0.0f ? -1.0f : 1.0f, 0.0f }; entered = true; }
+        if (t2 < tExit) tExit = t2;
+    }
+
+    // Y slab
+    if (fabsf(dir.y) < 1e-8f) {
+        if (origin.y <= minY || origin.y >= maxY) return false;
+    }
+    else {
+        float t1 = (minY - origin.y) / dir.y;
+        float t2 = (maxY - origin.y) / dir.y;
+        if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+        if (t1 >= tEnter) { tEnter = t1; enterNormal = { 0.0f, dir.y > 0.0f ? -1.0f : 1.0f }; entered = true; }
+        if (t2 < tExit) tExit = t2;
+    }
+
+    if (!entered || tEnter > tExit) return false;
+
+    *tHit = tEnter;
+    *normal = enterNormal;
+    return true;
+}
+
+// Segment against a circle, entries from outside only
+static bool SegmentEntersCircle(Vector2 origin, Vector2 dir, Vector2 center, float radius, float* tHit, Vector2* normal) {
+    float mx = origin.x - center.x;
+    float my = origin.y - center.y;
+    float a = dir.x * dir.x + dir.y * dir.y;
+    float b = mx * dir.x + my * dir.y;
+    float c = mx * mx + my * my - radius * radius;
+
+    if (a < 1e-12f) return false;
+    if (c > 0.0f && b > 0.0f) return false; // Outside and moving away
+
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) return false;
+
+    float t = (-b - sqrtf(discriminant)) / a;
+    if (t < 0.0f || t > 1.0f) return false;
+
+    *tHit = t;
+    *normal = { (mx + dir.x * t) / radius, (my + dir.y * t) / radius };
+    return true;
+}
+
+bool SweepCircleRect(Vector2 start, Vector2 delta, float radius, Rectangle rec, float* toi, Vector2* normal) {
+    const float minX = rec.x;
+    const float minY = rec.y;
+    const float maxX = rec.x + rec.width;
+    const float maxY = rec.y + rec.height;
+
+    // Already touching: report an immediate contact with the separating direction
+    float closestX = fmaxf(minX, fminf(start.x, maxX));
+    float closestY = fmaxf(minY, fminf(start.y, maxY));
+    float dx = start.x - closestX;
+    float dy = start.y - closestY;
+    float distSq = dx * dx + dy * dy;
+    if (distSq < radius * radius) {
+        if (distSq > 1e-12f) {
+            float dist = sqrtf(distSq);
+            *normal = { dx / dist, dy / dist };
+        }
+        else {
+            // Centre inside the rectangle: leave through the nearest side
+            float left = start.x - minX, right = maxX - start.x;
+            float top = start.y - minY, bottom = maxY - start.y;
+            float best = fminf(fminf(left, right), fminf(top, bottom));
+            if (best == left) *normal = { -1.0f, 0.0f };
+            else if (best == right) *normal = { 1.0f, 0.0f };
+            else if (best == top) *normal = { 0.0f, -1.0f };
+            else *normal = { 0.0f, 1.0f };
+        }
+        *toi = 0.0f;
+        return true;
+    }
+
+    // The set of centre positions touching the rectangle is the rectangle grown by the radius
+    // with rounded corners: two grown boxes plus four corner circles. The earliest entry into
+    // any of those pieces is the first contact.
+    bool hit = false;
+    float bestT = 2.0f;
+    Vector2 bestNormal = { 0.0f, 0.0f };
+    float t;
+    Vector2 n;
+
+    if (SegmentEntersBox(start, delta, minX - radius, minY, maxX + radius, maxY, &t, &n) && t < bestT) { bestT = t; bestNormal = n; hit = true; }
+    if (SegmentEntersBox(start, delta, minX, minY - radius, maxX, maxY + radius, &t, &n) && t < bestT) { bestT = t; bestNormal = n; hit = true; }
+
+    const Vector2 corners[4] = { { minX, minY }, { maxX, minY }, { minX, maxY }, { maxX, maxY } };
+    for (int i = 0; i < 4; ++i) {
+        if (SegmentEntersCircle(start, delta, corners[i], radius, &t, &n) && t < bestT) { bestT = t; bestNormal = n; hit = true; }
+    }
+
+    if (!hit) return false;
+
+    *toi = bestT;
+    *normal = bestNormal;
+    return true;
+}
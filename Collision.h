@@ -0,0 +1,19 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "raylib.h" // For Vector2, Rectangle (types only)
+
+//------------------------------------------------------------------------------------
+// Collision helpers for the simulation core
+// Same maths as raylib's CheckCollision* functions, but without linking raylib
+//------------------------------------------------------------------------------------
+bool CircleIntersectsRect(Vector2 center, float radius, Rectangle rec);
+bool RectsIntersect(Rectangle rec1, Rectangle rec2);
+
+// Continuous circle vs rectangle test
+// The circle starts at 'start' and moves by 'delta' this step. On contact returns true with the
+// time of impact as a fraction of delta (0..1) and the unit surface normal at the contact point.
+// A circle that already overlaps the rectangle reports toi = 0 and the direction that pushes it out.
+bool SweepCircleRect(Vector2 start, Vector2 delta, float radius, Rectangle rec, float* toi, Vector2* normal);
+
+#endif // COLLISION_H
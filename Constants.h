@@ -9,17 +9,29 @@
 const int WINDOW_WIDTH = 900;
 const int WINDOW_HEIGHT = 900;
 
+// Simulation Timing Constants
+const float SIM_TICK_RATE = 240.0f;          // Fixed physics ticks per second
+const float SIM_DT = 1.0f / SIM_TICK_RATE;   // Duration of one physics tick
+const float MAX_FRAME_TIME = 0.25f;          // Longer frames are clamped (e.g. after a window drag)
+const int MAX_SIM_STEPS_PER_FRAME = 16;      // Upper bound on physics work per rendered frame
+const unsigned int SIM_RANDOM_STREAM = 1;    // Random stream ids, a session seed drives both
+const unsigned int EFFECT_RANDOM_STREAM = 2;
+const unsigned int BOT_RANDOM_STREAM = 3;    // SimBot aiming error
+
 // Paddle Constants
 const float PADDLE_W = 150.0f;
 const float PADDLE_HE = 10.0f;
-const float PADDLE_SPEED = 7.0f;
-const float PADDLE_DECELERATION = 0.9f;
+const float PADDLE_SPEED = 1000.0f;       // Pixels per second
+const float PADDLE_DECELERATION = 15.0f;  // Exponential slowdown rate (1/s) when no key is held
 const float PADDLE_BOUNCE_MULTIPLIER = 0.8f; // Multiplier for paddle bounce angle
 
 // Ball Constants
 const float BALL_RADIUS = 10.0f;
 const Vector2 INITIAL_BALL_SPEED = { 500.0f, -500.0f };
 const float MAX_BALL_SPEED_X = 600.0f;
+const int MAX_BALLS = 10;
+const int MAX_BALL_CONTACTS_PER_TICK = 4; // Bounces resolved per ball per tick before the rest of its motion is dropped
+const float CONTACT_SKIN = 0.01f;         // Gap left between a ball and the surface it bounced off
 
 // Brick Constants
 const int BRICK_ROWS = 5;
@@ -29,6 +41,7 @@ const float BRICK_GAP = 2.0f;
 const float BRICK_TOP_OFFSET = 50.0f;
 const float BRICK_WIDTH = (WINDOW_WIDTH - (BRICK_COLUMNS + 1) * BRICK_GAP) / BRICK_COLUMNS;
 const int SCORE_PER_BRICK = 99999;
+const int CONFIG_ROW_LIVES = 8; // Rows with their own brick lives in SimConfig, lower rows repeat the last entry
 
 // Modifier Constants
 const float MODIFIER_CHANCE = 65.0f;
@@ -49,6 +62,38 @@ typedef enum {
     MOD_SCORE_BONUS
 } ModifierType;
 
+// Floating Text Constants
+const int MAX_FLOATING_TEXTS = 64;        // Live text effects, the closest to expiring is recycled beyond this
+const int MAX_FLOATING_TEXT_LENGTH = 24;  // Including the terminator
+
+// Rendering
+const int BOARD_CACHE_MAX_TEXTURE_SIZE = 4096; // Larger boards skip the cached texture and draw from the vertex buffer
+const int TEXT_CACHE_CAPACITY = 512;           // Hash slots (power of two), the cache resets at half full
+const int TEXT_CACHE_ATLAS_SIZE = 1024;        // Width and height of the text atlas
+const int TEXT_CACHE_MAX_LENGTH = 48;          // Longer strings aren't cached (terminator included)
+
+// Audio
+const int MAX_SOUND_VOICES = 8;       // Upper bound on a SoundVoicePool's polyphony
+const int SFX_PADDLE_HIT_VOICES = 3;
+const int SFX_BRICK_HIT_VOICES = 6;   // Multiball hit storms
+const int SFX_POWERUP_VOICES = 2;
+
+// Replays
+#define REPLAY_FILE_NAME "last_session.bbreplay" // Written on game over and on quit mid-game
+
+// Frame traces (F4 starts/stops, open in ui.perfetto.dev or chrome://tracing)
+#define TRACE_FILE_NAME "frame_timeline.trace.json"
+
+// Hitch captures: a frame longer than HITCH_THRESHOLD (s) writes hitch_<seed>_<n>.txt with the
+// profiler zones of the frames before it, plus hitch_<seed>_<n>.bbreplay of the session so far
+const float HITCH_THRESHOLD = 0.020f;  // About three frames at 144 fps
+const int HITCH_CAPTURE_FRAMES = 60;   // Frames of zone history in a capture (<= PROFILER_HISTORY_FRAMES)
+const int HITCH_MAX_CAPTURES = 10;     // Per session, later hitches are only counted
+const float HITCH_COOLDOWN = 1.0f;     // Seconds after a capture before the next one
+
+// Per-frame scratch memory
+const int FRAME_ARENA_SIZE = 64 * 1024;   // Initial bytes, grows once if a frame overflows it
+
 // Background Flash Constants
 const Color NORMAL_BG_COLOR = DARKGRAY;
 const Color FLASH_BG_COLOR = RED; //  maybe change based on hit
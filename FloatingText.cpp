@@ -1,15 +1,17 @@
 #include "FloatingText.h"
-#include "raylib.h" // For GetFrameTime, DrawTextEx, Fade, fmaxf, fminf
+#include "raylib.h" // For DrawTextEx, Fade, fmaxf, fminf
 #include <cmath>    // For fmaxf, fminf
+#include <cstring>  // For strncpy
 
 // Default constructor implementation
-FloatingText::FloatingText() : position{ 0,0 }, velocity{ 0,0 }, text(""), color(WHITE), fontSize(20), lifeTime(0), initialLifeTime(1.0f), active(false), pGameFont(nullptr) {}
+FloatingText::FloatingText() : position{ 0,0 }, velocity{ 0,0 }, text{}, color(WHITE), fontSize(20), lifeTime(0), initialLifeTime(1.0f), active(false), pGameFont(nullptr) {}
 
-void FloatingText::Init(Font* font, Vector2 pos, Vector2 vel, std::string txt, Color col, int size, float life) {
+void FloatingText::Init(Font* font, Vector2 pos, Vector2 vel, const char* txt, Color col, int size, float life) {
     pGameFont = font; // Store the pointer to the font
     position = pos;
     velocity = vel;
-    text = txt;
+    strncpy(text, txt, MAX_FLOATING_TEXT_LENGTH - 1);
+    text[MAX_FLOATING_TEXT_LENGTH - 1] = '\0';
     color = col;
     fontSize = size;
     lifeTime = life;
@@ -17,25 +19,68 @@ void FloatingText::Init(Font* font, Vector2 pos, Vector2 vel, std::string txt, C
     active = true;
 }
 
-void FloatingText::Update() {
+void FloatingText::Update(float dt) {
     if (active) {
-        lifeTime -= GetFrameTime(); // Decrease lifetime based on frame time
+        lifeTime -= dt; // Decrease lifetime by the elapsed time
         if (lifeTime <= 0) {
             active = false; // Deactivate when time runs out
         }
         else {
-            position.x += velocity.x * GetFrameTime();
-            position.y += velocity.y * GetFrameTime();
+            position.x += velocity.x * dt;
+            position.y += velocity.y * dt;
         }
     }
 }
 
-void FloatingText::Draw() const {
+void FloatingText::Draw(TextCache& cache) const {
     if (active && pGameFont && pGameFont->texture.id != 0) { // Check if font is valid
         float alpha = (lifeTime / initialLifeTime); // 1.0 when full, 0.0 when expired
         alpha = fmaxf(0.0f, fminf(1.0f, alpha)); // Clamp alpha between 0 and 1
 
-        DrawTextEx(*pGameFont, text.c_str(), position, (float)fontSize, 1, Fade(color, alpha));
+        cache.Draw(*pGameFont, text, position, (float)fontSize, 1, Fade(color, alpha));
     }
     // else if (active) { DrawText(...) }
-}
\ No newline at end of file
+}
+
+// ------------------------ FloatingTextPool Implementation ------------------------
+
+FloatingTextPool::FloatingTextPool() : count(0) {}
+
+void FloatingTextPool::Spawn(Font* font, Vector2 pos, Vector2 vel, const char* txt, Color col, int size, float life) {
+    int slot = count;
+    if (count < MAX_FLOATING_TEXTS) {
+        count++;
+    }
+    else {
+        // Full: recycle the effect that has the least time left
+        slot = 0;
+        for (int i = 1; i < count; ++i) {
+            if (items[i].lifeTime < items[slot].lifeTime) slot = i;
+        }
+    }
+    items[slot].Init(font, pos, vel, txt, col, size, life);
+}
+
+void FloatingTextPool::Update(float dt) {
+    for (int i = count - 1; i >= 0; --i) {
+        items[i].Update(dt);
+        if (!items[i].active) {
+            items[i] = items[count - 1]; // Swap-remove, order of effects doesn't matter
+            count--;
+        }
+    }
+}
+
+void FloatingTextPool::Draw(TextCache& cache) const {
+    for (int i = 0; i < count; ++i) {
+        items[i].Draw(cache);
+    }
+}
+
+void FloatingTextPool::Clear() {
+    count = 0;
+}
+
+int FloatingTextPool::Count() const {
+    return count;
+}
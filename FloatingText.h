@@ -3,12 +3,13 @@
 #define FLOATING_TEXT_H
 
 #include "raylib.h"
-#include <string>
+#include "Constants.h" // For MAX_FLOATING_TEXTS, MAX_FLOATING_TEXT_LENGTH
+#include "TextCache.h"
 
 struct FloatingText {
     Vector2 position;
     Vector2 velocity;
-    std::string text;
+    char text[MAX_FLOATING_TEXT_LENGTH]; // Stored inline (truncated if longer) so spawning never allocates
     Color color;
     int fontSize;
     float lifeTime;
@@ -19,9 +20,27 @@ struct FloatingText {
     FloatingText(); 
 
     // Pass font by pointer during Init
-    void Init(Font* font, Vector2 pos, Vector2 vel, std::string txt, Color col, int size, float life);
-    void Update();
-    void Draw() const;
+    void Init(Font* font, Vector2 pos, Vector2 vel, const char* txt, Color col, int size, float life);
+    void Update(float dt);
+    void Draw(TextCache& cache) const;
 };
 
-#endif
\ No newline at end of file
+// Fixed-capacity set of live text effects
+// Dead effects are swap-removed, and when the pool is full the effect closest to expiring
+// is recycled, so hit bursts never touch the heap.
+class FloatingTextPool {
+public:
+    FloatingTextPool();
+
+    void Spawn(Font* font, Vector2 pos, Vector2 vel, const char* txt, Color col, int size, float life);
+    void Update(float dt);
+    void Draw(TextCache& cache) const;
+    void Clear();
+    int Count() const;
+
+private:
+    FloatingText items[MAX_FLOATING_TEXTS];
+    int count;
+};
+
+#endif
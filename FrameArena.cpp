@@ -0,0 +1,80 @@
+#include "FrameArena.h"
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+FrameArena::FrameArena(std::size_t initialCapacity)
+    : head(NewBlock(initialCapacity, nullptr)), offset(0), used(0), capacity(initialCapacity), peak(0) {}
+
+FrameArena::~FrameArena() {
+    FreeBlocks(head);
+}
+
+FrameArena::Block* FrameArena::NewBlock(std::size_t size, Block* next) {
+    void* memory = std::malloc(sizeof(Block) + size);
+    if (memory == nullptr) throw std::bad_alloc();
+    Block* block = static_cast<Block*>(memory);
+    block->next = next;
+    block->size = size;
+    return block;
+}
+
+void FrameArena::FreeBlocks(Block* block) {
+    while (block != nullptr) {
+        Block* next = block->next;
+        std::free(block);
+        block = next;
+    }
+}
+
+void* FrameArena::Allocate(std::size_t size, std::size_t alignment) {
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(head->Data());
+    std::size_t aligned = ((base + offset + alignment - 1) & ~(std::uintptr_t)(alignment - 1)) - base;
+
+    if (aligned + size > head->size) {
+        // Overflow: chain a block big enough for this request and at least double the last one
+        std::size_t blockSize = head->size * 2;
+        if (blockSize < size + alignment) blockSize = size + alignment;
+        head = NewBlock(blockSize, head);
+        capacity += blockSize;
+        offset = 0;
+        base = reinterpret_cast<std::uintptr_t>(head->Data());
+        aligned = ((base + alignment - 1) & ~(std::uintptr_t)(alignment - 1)) - base;
+    }
+
+    offset = aligned + size;
+    used += size;
+    if (used > peak) peak = used;
+    return head->Data() + aligned;
+}
+
+void FrameArena::Reset() {
+    if (head->next != nullptr) {
+        // Last frame overflowed, replace the chain with one block that fits it
+        FreeBlocks(head);
+        head = NewBlock(capacity, nullptr);
+    }
+    offset = 0;
+    used = 0;
+}
+
+const char* FrameArena::Format(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = vsnprintf(nullptr, 0, format, argsCopy);
+    va_end(argsCopy);
+
+    if (length < 0) {
+        va_end(args);
+        return "";
+    }
+
+    char* buffer = static_cast<char*>(Allocate((std::size_t)length + 1, 1));
+    vsnprintf(buffer, (std::size_t)length + 1, format, args);
+    va_end(args);
+    return buffer;
+}
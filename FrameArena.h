@@ -0,0 +1,75 @@
+#pragma once
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+//------------------------------------------------------------------------------------
+// Linear per-frame allocator
+//------------------------------------------------------------------------------------
+// Allocations bump an offset and are never freed individually; Reset() at the top of
+// the frame releases everything at once. If a frame outgrows the block, extra blocks are
+// chained and the next Reset() folds them into one larger block, so after a warm-up
+// frame or two the arena stops touching the heap.
+class FrameArena {
+public:
+    explicit FrameArena(std::size_t initialCapacity);
+    ~FrameArena();
+
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+    void Reset();
+
+    // printf into the arena, string stays valid until the next Reset()
+    const char* Format(const char* format, ...);
+
+    std::size_t GetUsed() const { return used; }
+    std::size_t GetCapacity() const { return capacity; }
+    std::size_t GetPeak() const { return peak; }
+
+private:
+    struct Block {
+        Block* next;
+        std::size_t size;
+        char* Data() { return reinterpret_cast<char*>(this + 1); }
+    };
+
+    static Block* NewBlock(std::size_t size, Block* next);
+    static void FreeBlocks(Block* block);
+
+    Block* head;         // Current block, older overflow blocks hang off next
+    std::size_t offset;  // Bump offset into head
+    std::size_t used;    // Bytes handed out this frame, over all blocks
+    std::size_t capacity;
+    std::size_t peak;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+};
+
+//------------------------------------------------------------------------------------
+// STL allocator adaptor, deallocate is a no-op
+//------------------------------------------------------------------------------------
+template <typename T>
+struct FrameAllocator {
+    typedef T value_type;
+
+    FrameArena* arena;
+
+    explicit FrameAllocator(FrameArena* arena) noexcept : arena(arena) {}
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T*, std::size_t) noexcept {}
+};
+
+template <typename T, typename U>
+inline bool operator==(const FrameAllocator<T>& a, const FrameAllocator<U>& b) { return a.arena == b.arena; }
+template <typename T, typename U>
+inline bool operator!=(const FrameAllocator<T>& a, const FrameAllocator<U>& b) { return a.arena != b.arena; }
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+#endif // FRAME_ARENA_H
@@ -0,0 +1,64 @@
+#include "FrameHistogram.h"
+#include "BitOps.h"
+#include <cstring> // For memset
+
+FrameHistogram::FrameHistogram() {
+    Reset();
+}
+
+void FrameHistogram::Reset() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    sum = 0;
+    maxValue = 0;
+}
+
+// Buckets [0, SUB) hold their value exactly. Past that, a value whose highest bit is
+// 'msb' is shifted down to HISTOGRAM_SUB_BUCKET_BITS significant bits; the top half of
+// those (HALF..SUB-1) picks the linear bucket within its power of two.
+int FrameHistogram::BucketIndex(uint32_t value) {
+    if (value < (uint32_t)HISTOGRAM_SUB_BUCKETS) return (int)value;
+    int shift = HighestSetBit32(value) - (HISTOGRAM_SUB_BUCKET_BITS - 1);
+    return HISTOGRAM_SUB_BUCKETS + (shift - 1) * HISTOGRAM_HALF_BUCKETS + (int)(value >> shift) - HISTOGRAM_HALF_BUCKETS;
+}
+
+uint32_t FrameHistogram::BucketLow(int index) {
+    if (index < HISTOGRAM_SUB_BUCKETS) return (uint32_t)index;
+    int shift = (index - HISTOGRAM_SUB_BUCKETS) / HISTOGRAM_HALF_BUCKETS + 1;
+    uint32_t mantissa = (uint32_t)((index - HISTOGRAM_SUB_BUCKETS) % HISTOGRAM_HALF_BUCKETS + HISTOGRAM_HALF_BUCKETS);
+    return mantissa << shift;
+}
+
+uint32_t FrameHistogram::BucketHigh(int index) {
+    if (index < HISTOGRAM_SUB_BUCKETS) return (uint32_t)index;
+    int shift = (index - HISTOGRAM_SUB_BUCKETS) / HISTOGRAM_HALF_BUCKETS + 1;
+    return BucketLow(index) + ((1u << shift) - 1);
+}
+
+void FrameHistogram::Record(uint32_t microseconds) {
+    buckets[BucketIndex(microseconds)]++;
+    count++;
+    sum += microseconds;
+    if (microseconds > maxValue) maxValue = microseconds;
+}
+
+uint32_t FrameHistogram::GetPercentile(double percentile) const {
+    if (count == 0) return 0;
+
+    uint64_t rank = (uint64_t)(percentile / 100.0 * (double)count + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) return BucketHigh(i) < maxValue ? BucketHigh(i) : maxValue;
+    }
+    return maxValue;
+}
+
+uint64_t FrameHistogram::GetCountAbove(uint32_t microseconds) const {
+    uint64_t above = 0;
+    for (int i = BucketIndex(microseconds) + 1; i < HISTOGRAM_BUCKETS; ++i) above += buckets[i];
+    return above;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef FRAME_HISTOGRAM_H
+#define FRAME_HISTOGRAM_H
+
+#include <cstdint>
+
+//------------------------------------------------------------------------------------
+// Log-linear (HDR-style) histogram of frame times in microseconds
+// Values below 2^HISTOGRAM_SUB_BUCKET_BITS us get a bucket each; above that every power
+// of two is split into 2^(HISTOGRAM_SUB_BUCKET_BITS - 1) linear buckets, so any recorded
+// value is known to within ~3% from 1 us up to minutes in a few KB. Recording is a
+// bit scan and an increment, cheap enough to run every frame.
+//------------------------------------------------------------------------------------
+const int HISTOGRAM_SUB_BUCKET_BITS = 5;
+const int HISTOGRAM_SUB_BUCKETS = 1 << HISTOGRAM_SUB_BUCKET_BITS;
+const int HISTOGRAM_HALF_BUCKETS = HISTOGRAM_SUB_BUCKETS / 2;
+const int HISTOGRAM_BUCKETS = HISTOGRAM_SUB_BUCKETS + (32 - HISTOGRAM_SUB_BUCKET_BITS) * HISTOGRAM_HALF_BUCKETS;
+
+class FrameHistogram {
+public:
+    FrameHistogram();
+
+    void Record(uint32_t microseconds);
+    void Reset();
+
+    uint64_t GetCount() const { return count; }
+    uint32_t GetMax() const { return maxValue; }
+    double GetMean() const { return count > 0 ? (double)sum / count : 0.0; }
+    uint32_t GetPercentile(double percentile) const; // Upper edge of the bucket holding it, 0 if empty
+    uint64_t GetCountAbove(uint32_t microseconds) const; // Frames in buckets starting above the value
+
+    static int BucketIndex(uint32_t value);
+    static uint32_t BucketLow(int index);  // Smallest value that lands in the bucket
+    static uint32_t BucketHigh(int index); // Largest value that lands in the bucket
+
+private:
+    uint32_t buckets[HISTOGRAM_BUCKETS];
+    uint64_t count;
+    uint64_t sum;
+    uint32_t maxValue;
+};
+
+#endif // FRAME_HISTOGRAM_H
@@ -0,0 +1,244 @@
+#include "FrameTrace.h"
+#include "Profiler.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+std::atomic<bool> frameTraceRecording(false);
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+};
+
+// Single producer (the owning thread), single consumer (the writer thread)
+struct TraceRing {
+    TraceEvent events[TRACE_RING_EVENTS];
+    std::atomic<uint32_t> head; // Written by the owner
+    std::atomic<uint32_t> tail; // Written by the writer
+    std::atomic<uint64_t> dropped;
+    std::atomic<const char*> threadName; // Null until a thread claims the ring
+    bool named;                 // Writer has emitted the thread_name metadata
+};
+
+// Per-thread state, constant-initialized so nothing runs on threads that never trace.
+// Rings are never freed: a thread that raced a StopFrameTrace() may still write to its own.
+struct TraceThread {
+    TraceRing* ring;
+    bool noRing;                // Every ring was taken when this thread first traced
+    int openCount;
+    const char* openNames[TRACE_MAX_OPEN_SECTIONS];
+    uint64_t openStarts[TRACE_MAX_OPEN_SECTIONS]; // 0: opened while not recording
+};
+
+thread_local TraceThread traceThread = {};
+
+// All rings are allocated by the first StartFrameTrace(), so a thread's first event (the
+// audio callback's, say) only claims an index: no lock and no heap on that thread
+std::atomic<TraceRing*> rings(nullptr);
+std::atomic<int> ringClaims(0); // Keeps counting past TRACE_MAX_THREADS
+
+std::mutex writerMutex;
+std::condition_variable writerWake;
+std::thread writerThread;
+bool writerStop = false;
+FILE* traceFile = nullptr;
+bool firstEvent = true;
+uint64_t traceStartTicks = 0;
+std::chrono::steady_clock::time_point traceStartTime;
+
+TraceRing* GetThreadRing(const char* firstEventName) {
+    if (traceThread.ring != nullptr) return traceThread.ring;
+    if (traceThread.noRing) return nullptr;
+
+    TraceRing* all = rings.load(std::memory_order_acquire);
+    if (all == nullptr) return nullptr;
+
+    int index = ringClaims.fetch_add(1, std::memory_order_relaxed);
+    if (index >= TRACE_MAX_THREADS) {
+        traceThread.noRing = true;
+        return nullptr;
+    }
+
+    // The main loop is the profiled thread; others are named after the first thing they trace
+    TraceRing* ring = &all[index];
+    ring->threadName.store(GetProfilerThreadState().active ? "Main thread" : firstEventName, std::memory_order_release);
+    traceThread.ring = ring;
+    return ring;
+}
+
+double MicrosecondsPerTick() {
+#if PROFILER_USE_TSC
+    uint64_t ticks = ProfilerTimestamp() - traceStartTicks;
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - traceStartTime).count();
+    return ticks > 0 ? us / (double)ticks : 0.0;
+#else
+    return 1e-3;
+#endif
+}
+
+// Formats whatever the rings hold and appends it to the file. Writer thread only, or
+// StartFrameTrace/StopFrameTrace while the writer isn't running.
+void DrainRings(std::string& text) {
+    const double usPerTick = MicrosecondsPerTick();
+    TraceRing* all = rings.load(std::memory_order_relaxed);
+    char line[256];
+
+    for (int t = 0; t < TRACE_MAX_THREADS; ++t) {
+        TraceRing* ring = &all[t];
+        const char* threadName = ring->threadName.load(std::memory_order_acquire);
+        if (threadName == nullptr) continue;
+        uint32_t head = ring->head.load(std::memory_order_acquire);
+        uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+        if (head == tail) continue;
+
+        if (!ring->named) {
+            snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                firstEvent ? "\n" : ",\n", t + 1, threadName);
+            text += line;
+            firstEvent = false;
+            ring->named = true;
+        }
+
+        for (; tail != head; ++tail) {
+            const TraceEvent& event = ring->events[tail & (TRACE_RING_EVENTS - 1)];
+            // Sections opened just before the trace started land slightly before zero
+            double ts = event.start > traceStartTicks ? (event.start - traceStartTicks) * usPerTick : 0.0;
+            double dur = (event.end - event.start) * usPerTick;
+            snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                firstEvent ? "\n" : ",\n", event.name, ts, dur, t + 1);
+            text += line;
+            firstEvent = false;
+        }
+        ring->tail.store(tail, std::memory_order_release);
+    }
+
+    if (!text.empty()) {
+        fwrite(text.data(), 1, text.size(), traceFile);
+        text.clear();
+    }
+}
+
+void WriterLoop() {
+    std::string text;
+    text.reserve(1 << 16);
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (!writerStop) {
+        writerWake.wait_for(lock, std::chrono::milliseconds(TRACE_FLUSH_INTERVAL_MS));
+        lock.unlock();
+        DrainRings(text);
+        lock.lock();
+    }
+}
+
+} // namespace
+
+bool StartFrameTrace(const char* fileName) {
+    if (IsFrameTraceRecording() || writerThread.joinable()) return false;
+
+    traceFile = fopen(fileName, "wb");
+    if (traceFile == nullptr) return false;
+    fputs("{\"traceEvents\":[", traceFile);
+    firstEvent = true;
+
+    TraceRing* all = rings.load(std::memory_order_relaxed);
+    if (all == nullptr) {
+        // Default-initialized: the event arrays are only read after being written, and
+        // zeroing them would touch every page of ~12 MB up front
+        all = new TraceRing[TRACE_MAX_THREADS];
+        for (int t = 0; t < TRACE_MAX_THREADS; ++t) {
+            all[t].head.store(0, std::memory_order_relaxed);
+            all[t].tail.store(0, std::memory_order_relaxed);
+            all[t].dropped.store(0, std::memory_order_relaxed);
+            all[t].threadName.store(nullptr, std::memory_order_relaxed);
+        }
+        rings.store(all, std::memory_order_release);
+    }
+    else {
+        // Leftovers from threads that were mid-event when the last trace stopped
+        for (int t = 0; t < TRACE_MAX_THREADS; ++t) {
+            all[t].tail.store(all[t].head.load(std::memory_order_acquire), std::memory_order_release);
+            all[t].dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+    for (int t = 0; t < TRACE_MAX_THREADS; ++t) all[t].named = false;
+
+    // The caller (the main loop) claims its ring now rather than in its first traced zone
+    GetThreadRing("StartFrameTrace");
+
+    traceStartTicks = ProfilerTimestamp();
+    traceStartTime = std::chrono::steady_clock::now();
+    writerStop = false;
+    writerThread = std::thread(WriterLoop);
+    frameTraceRecording.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void StopFrameTrace() {
+    if (!writerThread.joinable()) return;
+    frameTraceRecording.store(false, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        writerStop = true;
+    }
+    writerWake.notify_one();
+    writerThread.join();
+
+    std::string text;
+    DrainRings(text);
+
+    unsigned long long dropped = 0;
+    TraceRing* all = rings.load(std::memory_order_relaxed);
+    for (int t = 0; t < TRACE_MAX_THREADS; ++t) dropped += all[t].dropped.load(std::memory_order_relaxed);
+
+    fprintf(traceFile, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":\"%llu\"}}\n", dropped);
+    fclose(traceFile);
+    traceFile = nullptr;
+}
+
+void WriteTraceEvent(const char* name, uint64_t start, uint64_t end) {
+    TraceRing* ring = GetThreadRing(name);
+    if (ring == nullptr) return;
+
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) >= (uint32_t)TRACE_RING_EVENTS) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    TraceEvent& event = ring->events[head & (TRACE_RING_EVENTS - 1)];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void TraceSection(const char* name, bool begin) {
+    TraceThread& thread = traceThread;
+
+    if (begin) {
+        if (thread.openCount < TRACE_MAX_OPEN_SECTIONS) {
+            thread.openNames[thread.openCount] = name;
+            thread.openStarts[thread.openCount] = IsFrameTraceRecording() ? ProfilerTimestamp() : 0;
+        }
+        thread.openCount++;
+        return;
+    }
+
+    if (thread.openCount == 0) return;
+    thread.openCount--;
+    if (thread.openCount >= TRACE_MAX_OPEN_SECTIONS) return;
+
+    uint64_t start = thread.openStarts[thread.openCount];
+    if (start != 0 && IsFrameTraceRecording()) {
+        WriteTraceEvent(thread.openNames[thread.openCount], start, ProfilerTimestamp());
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef FRAME_TRACE_H
+#define FRAME_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+
+//------------------------------------------------------------------------------------
+// Frame timeline export in Chrome trace format (chrome://tracing, ui.perfetto.dev)
+// Between StartFrameTrace() and StopFrameTrace() every profiler zone and every
+// TraceSection() pair becomes a complete event on its thread's track.
+//
+// Recording is wait-free: each thread appends to its own ring, which a background writer
+// thread drains every TRACE_FLUSH_INTERVAL_MS, formats and writes to the file. Events
+// that don't fit a full ring are dropped and counted in the trace's otherData.
+//
+// Timestamps are ProfilerTimestamp() ticks (Profiler.h), converted to microseconds by
+// the writer.
+//------------------------------------------------------------------------------------
+const int TRACE_RING_EVENTS = 1 << 15; // Per thread, a power of two
+const int TRACE_MAX_THREADS = 16;      // Threads past this are not traced
+const int TRACE_MAX_OPEN_SECTIONS = 16; // TraceSection() nesting per thread
+const int TRACE_FLUSH_INTERVAL_MS = 20;
+
+extern std::atomic<bool> frameTraceRecording;
+
+inline bool IsFrameTraceRecording() {
+    return frameTraceRecording.load(std::memory_order_relaxed);
+}
+
+bool StartFrameTrace(const char* fileName); // False if already recording or the file can't be opened
+void StopFrameTrace();                      // Flushes everything and closes the file
+
+// A finished section on the calling thread, name must outlive the trace (a literal)
+void WriteTraceEvent(const char* name, uint64_t start, uint64_t end);
+
+// Open (begin) or close the innermost section on the calling thread. Matches raylib's
+// TraceEventCallback so it can be passed to SetTraceEventCallback() directly.
+void TraceSection(const char* name, bool begin);
+
+#endif // FRAME_TRACE_H
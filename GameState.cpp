@@ -1,14 +1,20 @@
 #include "GameState.h"
 #include "Constants.h" // Include Constants header
-#include "Paddle.h"
-#include "Ball.h"
-#include "Brick.h"
-#include "Modifier.h"
+#include "Simulation.h"
 #include "FloatingText.h"
+#include "FrameArena.h"
+#include "BrickRenderer.h"
+#include "BoardCache.h"
+#include "TextCache.h"
+#include "SoundVoicePool.h"
+#include "AllocationCounter.h"
+#include "Replay.h"
+#include "Profiler.h"
+#include "FrameTrace.h"
+#include "FrameHistogram.h"
 #include <cmath>
-#include <cstdlib> // For GetRandomValue, srand, time
-#include <ctime>   // For time
-#include <algorithm> // For std::remove_if
+#include <cstdio>    // For snprintf
+#include <ctime>     // For time (session seed)
 #include <iostream>  // For std::cerr (error reporting)
 
 //------------------------------------------------------------------------------------
@@ -16,118 +22,138 @@
 //------------------------------------------------------------------------------------
 Font gameFont; // Actual definition
 GameState currentGameState = START_SCREEN;
-Paddle playerPaddle;
-std::vector<Ball> balls;
-Brick bricks[BRICK_ROWS][BRICK_COLUMNS]; // Definition for the array
-std::vector<Modifier> activeModifiers;
-std::vector<FloatingText> activeTextEffects;
+Simulation simulation;
+FloatingTextPool activeTextEffects;
 Color currentBackgroundColor = NORMAL_BG_COLOR;
 float backgroundFlashTimer = 0.0f;
-int score = 0;
 int highScore = 0; // Consider loading/saving this from a file later
-int activeBricksCount = 0;
-float gameTimer = 0.0f;
-Sound fxPaddleHit;
-Sound fxBrickHit;
-Sound fxPowerup;
+float simAccumulator = 0.0f;
+static char scoreHitText[MAX_FLOATING_TEXT_LENGTH]; // "+<SCORE_PER_BRICK>", formatted once at load
+SoundVoicePool fxPaddleHit;
+SoundVoicePool fxBrickHit;
+SoundVoicePool fxPowerup;
+FrameArena frameArena(FRAME_ARENA_SIZE);
+BrickRenderer brickRenderer;
+BoardCache boardCache;
+TextCache textCache;
+bool showMemoryStats = false;
+bool showProfiler = false;
+ReplayRecorder replayRecorder;
+Random effectRandom;
+FrameHistogram frameHistogram;
+static GameState lastFrameState = START_SCREEN; // State the previous frame ran in
+static float recentFrameMs[HITCH_CAPTURE_FRAMES]; // Ring of the last frame times, for hitch captures; < 0: not counted
+static int recentFrameHead = 0;
+static int recentFrames = 0; // Valid entries, up to HITCH_CAPTURE_FRAMES
+static int hitchCount = 0;
+static int hitchCaptures = 0;
+static float hitchCooldown = 0.0f;
+static bool skipNextFrameTime = false; // The frame after a capture pays for its file writes
+static unsigned long long frameStartAllocations = 0;
+static unsigned long long lastFrameAllocations = 0; // operator new calls during the previous frame
 
 //------------------------------------------------------------------------------------
 // Function Definitions
 //------------------------------------------------------------------------------------
 
+// Horizontally centred menu line, layout and glyphs come from the text cache
+static void DrawCenteredText(const char* text, float y, float fontSize, float spacing, Color color) {
+    float width = textCache.Measure(gameFont, text, fontSize, spacing).x;
+    textCache.Draw(gameFont, text, { WINDOW_WIDTH / 2.0f - width / 2, y }, fontSize, spacing, color);
+}
+
 void LoadGameResources() {
+    snprintf(scoreHitText, sizeof(scoreHitText), "+%i", SCORE_PER_BRICK);
+
     gameFont = LoadFont("resources/fonts/alagard.png");
     if (gameFont.texture.id == 0) {
         std::cerr << "Warning: Failed to load font 'resources/fonts/alagard.png'. Using default font." << std::endl;
         gameFont = GetFontDefault(); // Use default font as fallback
     }
 
-    fxPaddleHit = LoadSound("resources/sounds/paddle_hit.wav");
-    fxBrickHit = LoadSound("resources/sounds/brick_hit.wav");
-    fxPowerup = LoadSound("resources/sounds/powerup.wav");
+    // Each wav is loaded once, the extra voices are aliases sharing its samples
+    bool paddleLoaded = fxPaddleHit.Load("resources/sounds/paddle_hit.wav", SFX_PADDLE_HIT_VOICES);
+    bool brickLoaded = fxBrickHit.Load("resources/sounds/brick_hit.wav", SFX_BRICK_HIT_VOICES);
+    bool powerupLoaded = fxPowerup.Load("resources/sounds/powerup.wav", SFX_POWERUP_VOICES);
 
     // Check if sounds loaded 
-    if (fxPaddleHit.stream.buffer == nullptr) std::cerr << "Warning: Failed to load sound paddle_hit.wav" << std::endl;
-    if (fxBrickHit.stream.buffer == nullptr) std::cerr << "Warning: Failed to load sound brick_hit.wav" << std::endl;
-    if (fxPowerup.stream.buffer == nullptr) std::cerr << "Warning: Failed to load sound powerup.wav" << std::endl;
+    if (!paddleLoaded) std::cerr << "Warning: Failed to load sound paddle_hit.wav" << std::endl;
+    if (!brickLoaded) std::cerr << "Warning: Failed to load sound brick_hit.wav" << std::endl;
+    if (!powerupLoaded) std::cerr << "Warning: Failed to load sound powerup.wav" << std::endl;
 }
 
 void UnloadGameResources() {
-    UnloadSound(fxPaddleHit);
-    UnloadSound(fxBrickHit);
-    UnloadSound(fxPowerup);
+    // Quitting mid-game still leaves a replay of the session behind
+    if (replayRecorder.IsRecording()) SaveSessionReplay();
+    StopFrameTrace();
+
+    fxPaddleHit.Unload();
+    fxBrickHit.Unload();
+    fxPowerup.Unload();
     UnloadFont(gameFont);
+    brickRenderer.Unload();
+    boardCache.Unload();
+    textCache.Unload();
 }
 
 
-// Initialize/Reset Game State
-void InitGame() {
-    // Reset game variables
-    score = 0;
-    gameTimer = 0.0f;
-    balls.clear();
-    activeModifiers.clear();
-    activeTextEffects.clear();
-    currentBackgroundColor = NORMAL_BG_COLOR;
-    backgroundFlashTimer = 0.0f;
-
-    // Initialize Paddle
-    playerPaddle.Init(
-        { (WINDOW_WIDTH / 2.0f) - (PADDLE_W / 2.0f), WINDOW_HEIGHT * 0.9f },
-        { 0.0f, 0.0f }, // Initial speed (zero)
-        PADDLE_W,
-        PADDLE_HE,
-        SKYBLUE);
-
-    // Initialize Ball(s)
-    Ball initialBall;
-    initialBall.Init(
-        { WINDOW_WIDTH / 2.0f, playerPaddle.GetPosition().y - PADDLE_H - BALL_RADIUS - 5 },
-        INITIAL_BALL_SPEED,
-        BALL_RADIUS,
-        Color{ 2, 222, 233, 242 }
-    );
-    balls.push_back(initialBall);
-
-    // Initialize Bricks
-    ResetBricks(); // This also sets activeBricksCount
+// Write the session recorded so far to REPLAY_FILE_NAME and stop recording
+void SaveSessionReplay() {
+    if (!replayRecorder.Save(REPLAY_FILE_NAME, simulation)) {
+        std::cerr << "Warning: Failed to write replay '" << REPLAY_FILE_NAME << "'" << std::endl;
+    }
+    replayRecorder.Stop();
 }
 
-// Function to Reset/Initialize Bricks
-void ResetBricks() {
-    activeBricksCount = 0; // Reset the counter before initializing
-
-    for (int r = 0; r < BRICK_ROWS; ++r) {
-        for (int c = 0; c < BRICK_COLUMNS; ++c) {
-            Vector2 brickPos = {
-                c * (BRICK_WIDTH + BRICK_GAP) + BRICK_GAP,
-                r * (BRICK_HEIGHT + BRICK_GAP) + BRICK_GAP + BRICK_TOP_OFFSET
-            };
-            Vector2 brickSize = { BRICK_WIDTH, BRICK_HEIGHT };
-
-            // Determine lives based on row
-            int lives = 1;
-            if (r < 1) lives = 3;       // Top row gets 3 lives
-            else if (r < 3) lives = 2; // Next two rows get 2 lives
-
-            bricks[r][c].Init(brickPos, brickSize, r, c, lives);
-
-            if (bricks[r][c].lives > 0) {
-                activeBricksCount++;
-            }
-        }
+// F4: start a timeline trace of the following frames, or finish the one being recorded
+void ToggleFrameTrace() {
+    if (IsFrameTraceRecording()) {
+        StopFrameTrace();
+        std::cerr << "Frame trace written to '" << TRACE_FILE_NAME << "'" << std::endl;
     }
-    // Only give bonus and text effect if it's NOT the very first level init
-    if (gameTimer > 0.1f) { // Check if game has actually started
-        score += 999999; // Example bonus
-        SpawnTextEffect({ WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 3.0f }, "CLEARED! +999999", GOLD, 35, { 0, -40 }, 1.5f);
+    else if (!StartFrameTrace(TRACE_FILE_NAME)) {
+        std::cerr << "Warning: Failed to open trace file '" << TRACE_FILE_NAME << "'" << std::endl;
     }
 }
 
+// Initialize/Reset Game State
+void InitGame() {
+    // Every session gets a fresh seed; the replay stores it so the session can be reproduced
+    unsigned int seed = (unsigned int)time(NULL);
+    simulation.Init(seed);
+    effectRandom.Seed(seed, EFFECT_RANDOM_STREAM);
+    replayRecorder.Begin(seed, simulation.config);
+
+    frameHistogram.Reset();
+    hitchCount = 0;
+    hitchCaptures = 0;
+    hitchCooldown = 0.0f;
+
+    // Reset presentation state
+    simAccumulator = 0.0f;
+    activeTextEffects.Clear();
+    currentBackgroundColor = NORMAL_BG_COLOR;
+    backgroundFlashTimer = 0.0f;
+}
+
 // Update and Draw Frame
 void UpdateDrawFrame() {
+    // Everything allocated from the arena last frame is dead by now
+    unsigned long long allocations = GetHeapAllocationCount();
+    lastFrameAllocations = allocations - frameStartAllocations;
+    frameStartAllocations = allocations;
+    frameArena.Reset();
+    ProfilerEndFrame();
+    MonitorFrameTime();
+    PROFILE_ZONE("UpdateDrawFrame");
+
+    if (IsKeyPressed(KEY_F2)) showMemoryStats = !showMemoryStats;
+    if (IsKeyPressed(KEY_F3)) showProfiler = !showProfiler;
+    if (IsKeyPressed(KEY_F4)) ToggleFrameTrace();
+
     switch (currentGameState) {
     case START_SCREEN:
+    {
         if (IsKeyPressed(KEY_ENTER)) {
             InitGame();
             currentGameState = PLAYING;
@@ -135,13 +161,15 @@ void UpdateDrawFrame() {
         // Draw Start Screen elements
         BeginDrawing();
         ClearBackground(DARKBLUE);
-        DrawTextEx(gameFont, "BRICK BREAKER", { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, "BRICK BREAKER", 60, 2).x / 2, WINDOW_HEIGHT / 4.0f }, 60, 2, YELLOW);
-        DrawTextEx(gameFont, "EPILEPSY WARNING", { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, "EPILEPSY WARNING", 30, 2).x / 2, WINDOW_HEIGHT * 0.9f }, 30, 2, RED);
-        DrawTextEx(gameFont, "Press [ENTER] to Start", { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, "Press [ENTER] to Start", 30, 2).x / 2, WINDOW_HEIGHT / 2.0f }, 30, 2, WHITE);
-        DrawTextEx(gameFont, TextFormat("High Score: %i", highScore), { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, TextFormat("High Score: %i", highScore), 25, 2).x / 2, WINDOW_HEIGHT * 0.6f }, 25, 2, GOLD);
-        DrawTextEx(gameFont, "Controls: A/D or Left/Right Arrows to Move", { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, "Controls: A/D or Left/Right Arrows to Move", 20, 1).x / 2, WINDOW_HEIGHT * 0.8f }, 20, 1, LIGHTGRAY);
+        DrawCenteredText("BRICK BREAKER", WINDOW_HEIGHT / 4.0f, 60, 2, YELLOW);
+        DrawCenteredText("EPILEPSY WARNING", WINDOW_HEIGHT * 0.9f, 30, 2, RED);
+        DrawCenteredText("Press [ENTER] to Start", WINDOW_HEIGHT / 2.0f, 30, 2, WHITE);
+        const char* highScoreText = frameArena.Format("High Score: %i", highScore);
+        DrawCenteredText(highScoreText, WINDOW_HEIGHT * 0.6f, 25, 2, GOLD);
+        DrawCenteredText("Controls: A/D or Left/Right Arrows to Move", WINDOW_HEIGHT * 0.8f, 20, 1, LIGHTGRAY);
         EndDrawing();
         break;
+    }
 
     case PLAYING:
         UpdateGame();
@@ -149,8 +177,9 @@ void UpdateDrawFrame() {
         break;
 
     case GAME_OVER:
-        if (score > highScore) {
-            highScore = score; // Consider saving high score here
+    {
+        if (simulation.score > highScore) {
+            highScore = simulation.score; // Consider saving high score here
         }
         if (IsKeyPressed(KEY_R)) {
             currentGameState = START_SCREEN; // Go back to start screen
@@ -158,315 +187,307 @@ void UpdateDrawFrame() {
         // Draw Game Over Screen elements
         BeginDrawing();
         ClearBackground(BLACK);
-        DrawTextEx(gameFont, "GAME OVER", { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, "GAME OVER", 70, 2).x / 2, WINDOW_HEIGHT / 4.0f }, 70, 2, RED);
-        DrawTextEx(gameFont, TextFormat("Final Score: %i", score), { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, TextFormat("Final Score: %i", score), 40, 2).x / 2, WINDOW_HEIGHT / 2.0f }, 40, 2, WHITE);
-        DrawTextEx(gameFont, TextFormat("Time: %.2f s", gameTimer), { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, TextFormat("Time: %.2f s", gameTimer), 30, 2).x / 2, WINDOW_HEIGHT * 0.6f }, 30, 2, LIGHTGRAY);
-        DrawTextEx(gameFont, TextFormat("High Score: %i", highScore), { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, TextFormat("High Score: %i", highScore), 30, 2).x / 2, WINDOW_HEIGHT * 0.68f }, 30, 2, GOLD);
-        DrawTextEx(gameFont, "Press [R] to Restart", { WINDOW_WIDTH / 2.0f - MeasureTextEx(gameFont, "Press [R] to Restart", 30, 2).x / 2, WINDOW_HEIGHT * 0.8f }, 30, 2, YELLOW);
+        DrawCenteredText("GAME OVER", WINDOW_HEIGHT / 4.0f, 70, 2, RED);
+        const char* finalScoreText = frameArena.Format("Final Score: %i", simulation.score);
+        const char* finalTimeText = frameArena.Format("Time: %.2f s", simulation.gameTimer);
+        const char* highScoreText = frameArena.Format("High Score: %i", highScore);
+        DrawCenteredText(finalScoreText, WINDOW_HEIGHT / 2.0f, 40, 2, WHITE);
+        DrawCenteredText(finalTimeText, WINDOW_HEIGHT * 0.6f, 30, 2, LIGHTGRAY);
+        DrawCenteredText(highScoreText, WINDOW_HEIGHT * 0.68f, 30, 2, GOLD);
+        DrawCenteredText("Press [R] to Restart", WINDOW_HEIGHT * 0.8f, 30, 2, YELLOW);
         EndDrawing();
         break;
     }
+    }
+}
+
+// Feed the frame that just finished into the histogram and capture it if it was a hitch.
+// Only frames spent entirely in PLAYING count, so loading into a game isn't a hitch.
+void MonitorFrameTime() {
+    bool playing = currentGameState == PLAYING && lastFrameState == PLAYING;
+    lastFrameState = currentGameState;
+    float frameTime = GetFrameTime();
+    bool counted = playing && !skipNextFrameTime;
+    if (playing) skipNextFrameTime = false;
+
+    // Every frame takes a slot, counted or not, so the ring lines up with the profiler's history
+    recentFrameMs[recentFrameHead] = counted ? frameTime * 1000.0f : -1.0f;
+    recentFrameHead = (recentFrameHead + 1) % HITCH_CAPTURE_FRAMES;
+    if (recentFrames < HITCH_CAPTURE_FRAMES) recentFrames++;
+    if (!counted) return;
+
+    frameHistogram.Record((uint32_t)(frameTime * 1e6f));
+    hitchCooldown -= frameTime;
+
+    if (frameTime <= HITCH_THRESHOLD) return;
+    hitchCount++;
+    if (hitchCaptures >= HITCH_MAX_CAPTURES || hitchCooldown > 0.0f || !replayRecorder.IsRecording()) return;
+
+    SaveHitchCapture(frameTime * 1000.0f);
+    hitchCaptures++;
+    hitchCooldown = HITCH_COOLDOWN;
+    skipNextFrameTime = true;
+}
+
+// Write what the game looked like around a long frame: entity counts, frame times,
+// profiler zones of the frames leading up to it, and a replay that reaches this tick
+void SaveHitchCapture(float frameMs) {
+    const char* reportName = frameArena.Format("hitch_%u_%02d.txt", simulation.seed, hitchCaptures + 1);
+    const char* replayName = frameArena.Format("hitch_%u_%02d.bbreplay", simulation.seed, hitchCaptures + 1);
+
+    FILE* file = fopen(reportName, "w");
+    if (file == NULL) {
+        std::cerr << "Warning: Failed to write hitch capture '" << reportName << "'" << std::endl;
+        return;
+    }
+    bool replaySaved = replayRecorder.Save(replayName, simulation);
+
+    fprintf(file, "Hitch: %.2f ms frame (threshold %.2f ms), tick %llu, game time %.2f s\n",
+        frameMs, HITCH_THRESHOLD * 1000.0f, replayRecorder.GetTickCount(), simulation.gameTimer);
+    fprintf(file, "Entities: balls %d, modifiers %d, bricks %d/%d, floating texts %d, score %d\n",
+        simulation.balls.Count(), (int)simulation.modifiers.size(), simulation.bricks.GetLiveCount(),
+        simulation.config.brickRows * simulation.config.brickColumns, activeTextEffects.Count(), simulation.score);
+    fprintf(file, "Session frames: %llu, mean %.2f ms, p50 %.2f, p90 %.2f, p99 %.2f, p99.9 %.2f, max %.2f ms, hitches %d\n",
+        (unsigned long long)frameHistogram.GetCount(), frameHistogram.GetMean() / 1000.0,
+        frameHistogram.GetPercentile(50.0) / 1000.0f, frameHistogram.GetPercentile(90.0) / 1000.0f,
+        frameHistogram.GetPercentile(99.0) / 1000.0f, frameHistogram.GetPercentile(99.9) / 1000.0f,
+        frameHistogram.GetMax() / 1000.0f, hitchCount);
+    if (replaySaved) fprintf(file, "Replay: %s (session up to this tick, play it with replay_tool)\n", replayName);
+    else fprintf(file, "Replay: failed to write %s\n", replayName);
+
+    // One row per frame, newest first; frame 0 is the hitch. Frames left out of the histogram
+    // (menus, the one after a capture) show "-". Zones read 0 past the profiler's history.
+    int frames = recentFrames;
+    int zoneCount = GetProfileZoneCount();
+
+    fprintf(file, "\nLast %d frames (ms, newest first):\n%5s %8s", frames, "ago", "frame");
+    for (int z = 0; z < zoneCount; ++z) {
+        ProfileZoneStats stats;
+        if (GetProfileZoneStats(z, &stats)) fprintf(file, " %16s", stats.name);
+    }
+    fprintf(file, "\n");
+    for (int f = 0; f < frames; ++f) {
+        int slot = (recentFrameHead - 1 - f + 2 * HITCH_CAPTURE_FRAMES) % HITCH_CAPTURE_FRAMES;
+        if (recentFrameMs[slot] < 0.0f) fprintf(file, "%5d %8s", f, "-");
+        else fprintf(file, "%5d %8.2f", f, recentFrameMs[slot]);
+        for (int z = 0; z < zoneCount; ++z) fprintf(file, " %16.3f", GetProfileZoneHistoryMs(z, f));
+        fprintf(file, "\n");
+    }
+    if (!IsProfilerCompiledIn()) fprintf(file, "(profiler compiled out, no zone times)\n");
+
+    fclose(file);
+    std::cerr << "Hitch of " << frameMs << " ms captured to '" << reportName << "'" << std::endl;
 }
 
 // Update Game Logic for PLAYING state
+// Advances the simulation in fixed SIM_DT ticks so behaviour doesn't depend on the display rate.
+// Leftover time stays in simAccumulator and is used by DrawGame to interpolate positions.
 void UpdateGame() {
-    float dt = GetFrameTime();
-    gameTimer += dt;
+    PROFILE_ZONE("UpdateGame");
+    float frameTime = fminf(GetFrameTime(), MAX_FRAME_TIME);
+    simAccumulator += frameTime;
+
+    // Paddle Input (sampled once per frame, every tick of this frame sees the same keys)
+    SimInput input;
+    input.moveRight = IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT);
+    input.moveLeft = !input.moveRight && (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT));
+
+    // Events from every tick of this frame, handled once the ticks are done
+    FrameVector<SimEvent> frameEvents{ FrameAllocator<SimEvent>(&frameArena) };
+    frameEvents.reserve(64);
+
+    int steps = 0;
+    while (simAccumulator >= SIM_DT && steps < MAX_SIM_STEPS_PER_FRAME) {
+        replayRecorder.Record(input);
+        simulation.Step(input, SIM_DT);
+        simAccumulator -= SIM_DT;
+        steps++;
+
+        frameEvents.insert(frameEvents.end(), simulation.events.begin(), simulation.events.end());
+        if (simulation.gameOver) break; // Game over mid-frame, stop simulating
+    }
+
+    for (const SimEvent& event : frameEvents) {
+        HandleSimEvent(event);
+    }
+    if (currentGameState != PLAYING) return;
+    // Still behind after the step budget: drop the backlog instead of spiralling
+    if (simAccumulator >= SIM_DT) {
+        simAccumulator = fmodf(simAccumulator, SIM_DT);
+    }
 
     // Update Background Flash
     if (backgroundFlashTimer > 0.0f) {
-        backgroundFlashTimer -= dt;
+        backgroundFlashTimer -= frameTime;
         if (backgroundFlashTimer <= 0.0f) {
             currentBackgroundColor = NORMAL_BG_COLOR;
         }
     }
 
-    // Paddle Input and Movement
-    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT))
-        playerPaddle.SetSpeed(Vector2{ PADDLE_SPEED, 0.0f });
-    else if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT))
-        playerPaddle.SetSpeed(Vector2{ -PADDLE_SPEED, 0.0f });
-    else
-        playerPaddle.SetSpeed(Vector2{ playerPaddle.GetSpeed().x * PADDLE_DECELERATION, 0.0f });
-
-    playerPaddle.Update(); // Update paddle position
-
-    // Paddle Screen Bounds
-    if (playerPaddle.GetPosition().x <= 0)
-        playerPaddle.SetPosition(Vector2{ 0.0f, playerPaddle.GetPosition().y });
-    else if (playerPaddle.GetPosition().x + playerPaddle.GetWidth() >= WINDOW_WIDTH)
-        playerPaddle.SetPosition(Vector2{ WINDOW_WIDTH - playerPaddle.GetWidth(), playerPaddle.GetPosition().y });
+    // Update Text Effects (purely visual, so they follow the real frame time)
+    PROFILE_ZONE("Text update");
+    activeTextEffects.Update(frameTime);
+}
 
+// React to something the simulation reported (sounds, text, flashes)
+void HandleSimEvent(const SimEvent& event) {
+    switch (event.type) {
+    case SIM_EVENT_PADDLE_HIT:
+        PlaySfx(fxPaddleHit);
+        break;
 
-    // Ball Update and Collisions
-    for (int i = balls.size() - 1; i >= 0; --i)
+    case SIM_EVENT_BRICK_HIT:
     {
-        Ball& ball = balls[i];
-        if (!ball.active) continue;
-
-        ball.Update(); // Update ball position
-
-        // Ball vs Walls Collision
-        if (ball.position.x - ball.radius <= 0 || ball.position.x + ball.radius >= WINDOW_WIDTH) {
-            ball.speed.x *= -1.0f;
-            if (ball.position.x - ball.radius <= 0) ball.position.x = ball.radius + 0.1f;
-            if (ball.position.x + ball.radius >= WINDOW_WIDTH) ball.position.x = WINDOW_WIDTH - ball.radius - 0.1f;
-        }
-        if (ball.position.y - ball.radius <= 0) {
-            ball.speed.y *= -1.0f;
-            ball.position.y = ball.radius + 0.1f;
+        // Determine text color randomly
+        Color textColor;
+        int randColor = effectRandom.Range(0, 4);
+        switch (randColor) {
+        case 0: textColor = GOLD; break; case 1: textColor = PURPLE; break;
+        case 2: textColor = GREEN; break; case 3: textColor = BLUE; break;
+        default: textColor = DARKBROWN; break;
         }
 
-        // Ball vs Bottom Edge
-        if (ball.position.y + ball.radius >= WINDOW_HEIGHT) {
-            ball.active = false;
-            // Don't set game over yet, wait until all balls are checked
+        // Trigger Background Flash
+        currentBackgroundColor = ColorBrightness(textColor, -0.5f); // Flash slightly darker than text
+        backgroundFlashTimer = FLASH_DURATION;
+
+        // Determine hit text randomly
+        const char* hitText;
+        int randText = effectRandom.Range(0, 5);
+        switch (randText) {
+        case 0: hitText = scoreHitText; break;
+        case 1: hitText = "POP!"; break; case 2: hitText = "BAM!!!!!"; break;
+        case 3: hitText = "CRACK!!!!!"; break; case 4: hitText = "SMASH!"; break; // Shortened examples
+        case 5: hitText = "GREAT!"; break;
+        default: hitText = scoreHitText; break;
         }
 
-        // Ball vs Paddle Collision
-        if (CheckCollisionCircleRec(ball.position, ball.radius, playerPaddle.GetPaddleRectangle()))
-        {
-            if (ball.speed.y > 0) { // Only bounce if moving downwards
-                // Adjust Y position to prevent sinking
-                ball.position.y = playerPaddle.GetPosition().y - ball.radius - 0.1f;
+        SpawnTextEffect(event.position, hitText, textColor, 40, { (float)effectRandom.Range(-20, 20), -50.0f }, 0.85f);
 
-                float hitPos = ball.position.x - (playerPaddle.GetPosition().x + playerPaddle.GetWidth() / 2.0f);
-                float normalizedHitPos = hitPos / (playerPaddle.GetWidth() / 2.0f);
-                normalizedHitPos = fmaxf(-0.95f, fminf(0.95f, normalizedHitPos)); // Clamp influence
-
-                ball.speed.x = MAX_BALL_SPEED_X * normalizedHitPos * PADDLE_BOUNCE_MULTIPLIER;
-
-                // Maintain overall speed (approximately)
-                float speedMagnitude = sqrtf(INITIAL_BALL_SPEED.x * INITIAL_BALL_SPEED.x + INITIAL_BALL_SPEED.y * INITIAL_BALL_SPEED.y);
-                ball.speed.y = -sqrtf(fmaxf(1.0f, speedMagnitude * speedMagnitude - ball.speed.x * ball.speed.x)); // Ensure Y speed is reasonable
-
-                PlaySfx(fxPaddleHit);
-            }
-        }
-
-        // Ball vs Bricks Collision
-        bool brickHit = false;
-        for (int r = 0; r < BRICK_ROWS && !brickHit; ++r) {
-            for (int c = 0; c < BRICK_COLUMNS && !brickHit; ++c) {
-                if (!bricks[r][c].IsDestroyed()) {
-                    if (CheckCollisionCircleRec(ball.position, ball.radius, bricks[r][c].GetRect())) {
-
-                        Vector2 brickCenter = { bricks[r][c].position.x + bricks[r][c].size.x / 2, bricks[r][c].position.y + bricks[r][c].size.y / 2 };
-                        Color brickColor = bricks[r][c].color;
-
-                        // Determine text color randomly
-                        Color textColor;
-                        int randColor = GetRandomValue(0, 4);
-                        switch (randColor) {
-                        case 0: textColor = GOLD; break; case 1: textColor = PURPLE; break;
-                        case 2: textColor = GREEN; break; case 3: textColor = BLUE; break;
-                        default: textColor = DARKBROWN; break;
-                        }
-
-                        // Trigger Background Flash
-                        currentBackgroundColor = ColorBrightness(textColor, -0.5f); // Flash slightly darker than text
-                        backgroundFlashTimer = FLASH_DURATION;
-
-                        // Determine hit text randomly
-                        std::string hitText;
-                        int randText = GetRandomValue(0, 5);
-                        switch (randText) {
-                        case 0: hitText = "+" + std::to_string(SCORE_PER_BRICK); break;
-                        case 1: hitText = "POP!"; break; case 2: hitText = "BAM!!!!!"; break;
-                        case 3: hitText = "CRACK!!!!!"; break; case 4: hitText = "SMASH!"; break; // Shortened examples
-                        case 5: hitText = "GREAT!"; break;
-                        default: hitText = "+" + std::to_string(SCORE_PER_BRICK); break;
-                        }
-
-                        SpawnTextEffect(brickCenter, hitText, textColor, 40, { (float)GetRandomValue(-20, 20), -50.0f }, 0.85f);
-
-                        PlaySfx(fxBrickHit);
-                        bricks[r][c].Hit(); // Damage the brick
-
-                        if (bricks[r][c].IsDestroyed()) {
-                            score += SCORE_PER_BRICK;
-                            activeBricksCount--;
-                            if (GetRandomValue(1, 100) <= MODIFIER_CHANCE) {
-                                SpawnModifier(brickCenter);
-                            }
-                        }
-
-                        // Accurate Bounce Logic
-                        Rectangle brickRect = bricks[r][c].GetRect();
-                        float overlapX = (ball.radius + brickRect.width / 2) - fabsf(ball.position.x - (brickRect.x + brickRect.width / 2));
-                        float overlapY = (ball.radius + brickRect.height / 2) - fabsf(ball.position.y - (brickRect.y + brickRect.height / 2));
-
-                        bool verticalCollision = overlapY < overlapX;
-                        // Tie-breaking for corner hits (optional refinement)
-                        if (fabsf(overlapX - overlapY) < 1.0f) { // If overlaps are very close, consider velocity direction
-                            verticalCollision = fabsf(ball.speed.y) > fabsf(ball.speed.x);
-                        }
-
-
-                        if (verticalCollision) {
-                            ball.speed.y *= -1;
-                            // Nudge ball out vertically
-                            ball.position.y += (ball.speed.y > 0 ? overlapY : -overlapY) * 0.51f;
-                        }
-                        else {
-                            ball.speed.x *= -1;
-                            // Nudge ball out horizontally
-                            ball.position.x += (ball.speed.x > 0 ? overlapX : -overlapX) * 0.51f;
-                        }
-
-
-                        brickHit = true; // Prevent multiple brick hits per ball per frame
-                    }
-                }
-            }
-        }
-    } // End ball loop
-
-    // Modifier Update and Collisions
-    for (int i = activeModifiers.size() - 1; i >= 0; --i) {
-        Modifier& mod = activeModifiers[i];
-        if (!mod.active) continue;
-
-        mod.Update();
-
-        if (mod.active && CheckCollisionRecs(mod.GetRect(), playerPaddle.GetPaddleRectangle())) {
-            ActivateModifier(mod);
-            mod.active = false;
-            PlaySfx(fxPowerup);
-        }
+        PlaySfx(fxBrickHit);
     }
+    break;
 
-    // Update Text Effects
-    for (int i = activeTextEffects.size() - 1; i >= 0; --i) {
-        activeTextEffects[i].Update();
-    }
+    case SIM_EVENT_MODIFIER_COLLECTED:
+        if (event.value == MOD_MULTIBALL) SpawnTextEffect(event.position, "MULTI!", BLUE, 42, { 0.0f, -60.0f }, 1.0f);
+        else if (event.value == MOD_SCORE_BONUS) SpawnTextEffect(event.position, "+99999!", GOLD, 42, { 0.0f, -60.0f }, 1.0f);
+        PlaySfx(fxPowerup);
+        break;
 
-    // Cleanup Inactive Objects
-    balls.erase(std::remove_if(balls.begin(), balls.end(), [](const Ball& b) { return !b.active; }), balls.end());
-    activeModifiers.erase(std::remove_if(activeModifiers.begin(), activeModifiers.end(), [](const Modifier& m) { return !m.active; }), activeModifiers.end());
-    activeTextEffects.erase(std::remove_if(activeTextEffects.begin(), activeTextEffects.end(), [](const FloatingText& t) { return !t.active; }), activeTextEffects.end());
+    case SIM_EVENT_LEVEL_CLEARED:
+        SpawnTextEffect(event.position, "CLEARED! +999999", GOLD, 35, { 0, -40 }, 1.5f);
+        break;
 
-    // Check Game Over Condition (No active balls left)
-    if (balls.empty() && currentGameState == PLAYING) {
-        currentGameState = GAME_OVER;
-        return; // Exit UpdateGame early if game is over
-    }
+    case SIM_EVENT_BALL_LOST:
+        break;
 
-    // Check Win Condition (No active bricks left) -> Reset Level
-    if (activeBricksCount <= 0 && currentGameState == PLAYING) {
-        ResetBricks(); // Reset bricks for a new level
-
-        // Reset ball position and speed (using the first ball if multiple exist)
-        if (!balls.empty()) {
-            balls[0].position = { WINDOW_WIDTH / 2.0f, playerPaddle.GetPosition().y - PADDLE_H - BALL_RADIUS - 5 };
-            balls[0].speed = INITIAL_BALL_SPEED; // Reset speed
-            // Make sure the first ball is active if somehow it wasn't
-            balls[0].active = true;
-            // Remove any other extra balls from multiball etc.
-            balls.resize(1);
-        }
-        else {
-            // This case shouldn't happen if gameover check is correct, but just in case:
-            InitGame(); // Full reset if no balls left somehow when bricks are cleared
-        }
+    case SIM_EVENT_GAME_OVER:
+        currentGameState = GAME_OVER;
+        SaveSessionReplay();
+        break;
     }
 }
 
 // Draw the Game Screen (PLAYING state)
 void DrawGame() {
+    PROFILE_ZONE("DrawGame");
+    // How far we are between the last simulated tick and the next one
+    float alpha = simAccumulator / SIM_DT;
+
+    // Repaint the cells hit since last frame into the cached board (outside BeginDrawing,
+    // it switches render targets). Boards too big for a texture go through the vertex buffer.
+    bool boardCached = boardCache.Sync(simulation.bricks);
+    if (!boardCached) brickRenderer.Sync(simulation.bricks);
+
     BeginDrawing();
     ClearBackground(currentBackgroundColor); // Use dynamic background color
 
     // Draw Bricks
-    for (int r = 0; r < BRICK_ROWS; ++r) {
-        for (int c = 0; c < BRICK_COLUMNS; ++c) {
-            bricks[r][c].Draw();
-        }
-    }
+    if (boardCached) boardCache.Draw();
+    else brickRenderer.Draw();
 
     // Draw Paddle
-    playerPaddle.Draw();
+    const Paddle& paddle = simulation.paddle;
+    Vector2 paddlePos = paddle.GetDrawPosition(alpha);
+    DrawRectangle(static_cast<int>(paddlePos.x), static_cast<int>(paddlePos.y),
+        static_cast<int>(paddle.GetWidth()), static_cast<int>(paddle.GetHeight()), paddle.GetColor());
 
     // Draw Ball(s)
-    for (const auto& ball : balls) {
-        ball.Draw();
+    const BallPool& balls = simulation.balls;
+    for (int i = 0; i < balls.Count(); ++i) {
+        if (balls.active[i]) {
+            DrawCircleV(balls.GetDrawPosition(i, alpha), balls.radius[i], balls.color[i]);
+        }
     }
 
     // Draw Modifiers
-    for (const auto& mod : activeModifiers) {
-        mod.Draw();
+    for (const auto& mod : simulation.modifiers) {
+        if (!mod.active) continue;
+        Vector2 modPos = mod.GetDrawPosition(alpha);
+        // Draw based on type
+        switch (mod.type) {
+        case MOD_MULTIBALL: DrawCircleV(modPos, mod.size / 2.0f, mod.color); break;
+        case MOD_SCORE_BONUS: DrawRectangleV({ modPos.x - mod.size / 2, modPos.y - mod.size / 2 }, { mod.size, mod.size }, mod.color); break;
+        default: DrawCircleV(modPos, mod.size / 2.0f, mod.color); break; // Default draw as circle
+        }
     }
 
     // Draw Text Effects
-    for (const auto& textEffect : activeTextEffects) {
-        textEffect.Draw();
-    }
+    activeTextEffects.Draw(textCache);
 
     // Draw UI
-    DrawTextEx(gameFont, TextFormat("Score: %i", score), { 10, 10 }, 30, 2, GOLD);
-    DrawTextEx(gameFont, TextFormat("Time: %.1f", gameTimer), { WINDOW_WIDTH - 150.0f, 10 }, 30, 2, WHITE);
+    textCache.Draw(gameFont, frameArena.Format("Score: %i", simulation.score), { 10, 10 }, 30, 2, GOLD);
+    textCache.Draw(gameFont, frameArena.Format("Time: %.1f", simulation.gameTimer), { WINDOW_WIDTH - 150.0f, 10 }, 30, 2, WHITE);
+    if (showMemoryStats) {
+        const char* allocs = IsAllocationCountingCompiledIn() ? frameArena.Format("%llu", lastFrameAllocations) : "not counted";
+        const char* stats = frameArena.Format("Heap allocs/frame: %s  Arena: %zu/%zu B (peak %zu)",
+            allocs, frameArena.GetUsed(), frameArena.GetCapacity(), frameArena.GetPeak());
+        DrawTextEx(gameFont, stats, { 10, WINDOW_HEIGHT - 30.0f }, 20, 1, LIME); // Changes every frame, bypass the cache
+    }
+    if (showProfiler) DrawProfilerOverlay();
+    if (IsFrameTraceRecording()) DrawTextEx(gameFont, "TRACE", { WINDOW_WIDTH - 80.0f, WINDOW_HEIGHT - 30.0f }, 20, 1, RED);
 
+    PROFILE_ZONE("EndDrawing"); // Includes the buffer swap and the frame-rate wait
     EndDrawing();
 }
 
-// Spawn a floating text effect
-void SpawnTextEffect(Vector2 position, const std::string& text, Color color, int fontSize, Vector2 velocity, float lifeTime) {
-    FloatingText newTextEffect;
-    // Pass the address of the global gameFont
-    newTextEffect.Init(&gameFont, position, velocity, text, color, fontSize, lifeTime);
-    activeTextEffects.push_back(newTextEffect);
-}
-
-// Spawn a Modifier
-void SpawnModifier(Vector2 position) {
-    Modifier newMod;
-    int randType = GetRandomValue(0, 1); // Only two types currently
-    ModifierType type = MOD_NONE;
-    switch (randType) {
-    case 0: type = MOD_MULTIBALL; break;
-    case 1: type = MOD_SCORE_BONUS; break;
-    }
-
-    if (type != MOD_NONE) {
-        newMod.Init(position, type);
-        activeModifiers.push_back(newMod);
+// Per-zone times over the last PROFILER_HISTORY_FRAMES frames (F3)
+void DrawProfilerOverlay() {
+    const float fontSize = 18.0f;
+    const float lineHeight = 20.0f;
+    const Vector2 origin = { 10.0f, 50.0f };
+    int zoneCount = GetProfileZoneCount();
+
+    DrawRectangle((int)origin.x - 5, (int)origin.y - 5, 520, (int)(lineHeight * (zoneCount + 2)) + 10, Fade(BLACK, 0.7f));
+
+    const char* histogram = frameArena.Format("Frames %llu  p50 %.2f  p99 %.2f  max %.2f ms  hitches %d",
+        (unsigned long long)frameHistogram.GetCount(), frameHistogram.GetPercentile(50.0) / 1000.0f,
+        frameHistogram.GetPercentile(99.0) / 1000.0f, frameHistogram.GetMax() / 1000.0f, hitchCount);
+    DrawTextEx(gameFont, histogram, { origin.x, origin.y + lineHeight * (zoneCount + 1) }, fontSize, 1, SKYBLUE);
+
+    const char* header = IsProfilerCompiledIn()
+        ? frameArena.Format("Frame %.2f ms   (ms)  last    min    avg    p99", GetProfilerFrameMs())
+        : "Profiler compiled out (BRICKBREAKER_PROFILE=0)";
+    DrawTextEx(gameFont, header, origin, fontSize, 1, YELLOW);
+
+    int order[MAX_PROFILE_ZONES];
+    int listed = GetProfileZoneOrder(order);
+    for (int i = 0; i < listed; ++i) {
+        ProfileZoneStats stats;
+        if (!GetProfileZoneStats(order[i], &stats)) continue;
+        const char* line = frameArena.Format("%*s%-*s %6.2f %6.2f %6.2f %6.2f  x%d", stats.depth * 2, "", 20 - stats.depth * 2, stats.name,
+            stats.lastMs, stats.minMs, stats.avgMs, stats.p99Ms, stats.calls);
+        DrawTextEx(gameFont, line, { origin.x, origin.y + lineHeight * (i + 1) }, fontSize, 1, LIME);
     }
 }
 
-// Activate Modifier Effect
-void ActivateModifier(Modifier& mod) {
-    switch (mod.type) {
-    case MOD_MULTIBALL:
-    {
-        int ballsToSpawn = 4; // Spawn two extra balls
-        Vector2 spawnPos = mod.position; // Spawn near where modifier was collected
-
-        for (int i = 0; i < ballsToSpawn && balls.size() < 10; ++i) { // Limit max balls
-            Ball extraBall;
-            // Give new ball slightly random upward velocity from paddle
-            Vector2 newSpeed = {
-                 INITIAL_BALL_SPEED.x * ((float)GetRandomValue(5, 15) / 10.0f) * (GetRandomValue(0,1) == 0 ? 1.0f : -1.0f) , // Random horizontal component
-                -fabs(INITIAL_BALL_SPEED.y) * ((float)GetRandomValue(8, 12) / 10.0f) // Random upward vertical
-            };
-
-            extraBall.Init(spawnPos, newSpeed, BALL_RADIUS, SKYBLUE);
-            balls.push_back(extraBall);
-        }
-        SpawnTextEffect(mod.position, "MULTI!", BLUE, 42, { 0.0f, -60.0f }, 1.0f);
-    }
-    break;
-    case MOD_SCORE_BONUS:
-        score += 99999;
-        SpawnTextEffect(mod.position, "+99999!", GOLD, 42, { 0.0f, -60.0f }, 1.0f);
-        break;
-    case MOD_NONE:
-        break; // Should not happen if SpawnModifier works correctly
-    }
+// Spawn a floating text effect
+void SpawnTextEffect(Vector2 position, const char* text, Color color, int fontSize, Vector2 velocity, float lifeTime) {
+    // Pass the address of the global gameFont
+    activeTextEffects.Spawn(&gameFont, position, velocity, text, color, fontSize, lifeTime);
 }
 
 // Play Sound Effect Safely
-void PlaySfx(Sound& sfx) {
-    if (sfx.stream.buffer != nullptr) { // Check if sound is loaded
-        PlaySound(sfx);
-    }
+void PlaySfx(SoundVoicePool& sfx) {
+    sfx.Play(); // No-op if the sound failed to load
 }
\ No newline at end of file
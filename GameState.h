@@ -2,49 +2,58 @@
 #define GAME_STATE_H
 
 #include "raylib.h"
-#include <vector>
-#include <string>
 #include "Constants.h"
-#include "Paddle.h" 
-#include "Ball.h"
-#include "Brick.h"
-#include "Modifier.h"
+#include "Simulation.h"
 #include "FloatingText.h"
+#include "FrameArena.h"
+#include "BrickRenderer.h"
+#include "BoardCache.h"
+#include "TextCache.h"
+#include "SoundVoicePool.h"
+#include "Replay.h"
+#include "FrameHistogram.h"
 
 //------------------------------------------------------------------------------------
 // Global Variables (Declarations) - use 'extern'
 //------------------------------------------------------------------------------------
 extern Font gameFont; // Make font globally accessible if needed by multiple files (like FloatingText)
 extern GameState currentGameState;
-extern Paddle playerPaddle;
-extern std::vector<Ball> balls;
-extern Brick bricks[BRICK_ROWS][BRICK_COLUMNS];
-extern std::vector<Modifier> activeModifiers;
-extern std::vector<FloatingText> activeTextEffects;
+extern Simulation simulation; // Gameplay state (paddle, balls, bricks, modifiers, score)
+extern FloatingTextPool activeTextEffects;
 extern Color currentBackgroundColor;
 extern float backgroundFlashTimer;
-extern int score;
 extern int highScore;
-extern int activeBricksCount;
-extern float gameTimer;
-extern Sound fxPaddleHit;
-extern Sound fxBrickHit;
-extern Sound fxPowerup;
+extern float simAccumulator; // Unsimulated time carried over to the next frame
+extern SoundVoicePool fxPaddleHit;
+extern SoundVoicePool fxBrickHit;
+extern SoundVoicePool fxPowerup;
+extern FrameArena frameArena; // Transient per-frame memory, reset at the top of UpdateDrawFrame
+extern BrickRenderer brickRenderer; // GPU copy of simulation.bricks, used when the board can't be cached
+extern BoardCache boardCache;       // simulation.bricks rasterized into a texture
+extern TextCache textCache;         // Pre-rasterized text runs for the HUD, menus and floating text
+extern bool showMemoryStats;  // F2: heap allocations per frame and arena usage
+extern bool showProfiler;     // F3: per-zone frame times
+extern ReplayRecorder replayRecorder; // Seed and per-tick input of the current session
+extern Random effectRandom;  // Cosmetic randomness (hit text, colours), kept off the simulation's stream
+extern FrameHistogram frameHistogram; // Frame times of the current session (us), shown on the F3 overlay
 
 //------------------------------------------------------------------------------------
 // Function Declarations
 //------------------------------------------------------------------------------------
 void InitGame();
-void ResetBricks();
 void UpdateGame();
 void DrawGame();
+void DrawProfilerOverlay();
 void UpdateDrawFrame();
-void SpawnModifier(Vector2 position);
-void SpawnTextEffect(Vector2 position, const std::string& text, Color color, int fontSize, Vector2 velocity, float lifeTime);
-void ActivateModifier(Modifier& mod);
-void PlaySfx(Sound& sfx);
+void HandleSimEvent(const SimEvent& event);
+void SpawnTextEffect(Vector2 position, const char* text, Color color, int fontSize, Vector2 velocity, float lifeTime);
+void PlaySfx(SoundVoicePool& sfx);
+void SaveSessionReplay();
+void ToggleFrameTrace();
+void MonitorFrameTime();
+void SaveHitchCapture(float frameMs);
 void LoadGameResources();   
 void UnloadGameResources();
 
 
-#endif // GAME_STATE_H
\ No newline at end of file
+#endif // GAME_STATE_H
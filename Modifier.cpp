@@ -1,12 +1,12 @@
 #include "Modifier.h"
-#include "raylib.h" // For GetFrameTime, DrawCircleV, DrawRectangleV
 #include "Constants.h" // Include again for constants if needed inside methods
 
 // Default constructor implementation
-Modifier::Modifier() : position{ 0,0 }, velocity{ 0,0 }, type(MOD_NONE), active(false), color(WHITE), size(MODIFIER_SIZE) {}
+Modifier::Modifier() : position{ 0,0 }, prevPosition{ 0,0 }, velocity{ 0,0 }, type(MOD_NONE), active(false), color(WHITE), size(MODIFIER_SIZE) {}
 
 void Modifier::Init(Vector2 pos, ModifierType t) {
     position = pos;
+    prevPosition = pos;
     velocity = { 0.0f, MODIFIER_SPEED }; // Modifiers fall downwards
     type = t;
     active = true;
@@ -19,9 +19,10 @@ void Modifier::Init(Vector2 pos, ModifierType t) {
     }
 }
 
-void Modifier::Update() {
+void Modifier::Update(float dt) {
     if (active) {
-        position.y += velocity.y * GetFrameTime();
+        prevPosition = position;
+        position.y += velocity.y * dt;
         // Deactivate if off-screen
         if (position.y > WINDOW_HEIGHT + size) {
             active = false;
@@ -29,15 +30,11 @@ void Modifier::Update() {
     }
 }
 
-void Modifier::Draw() const {
-    if (active) {
-        // Draw based on type
-        switch (type) {
-        case MOD_MULTIBALL: DrawCircleV(position, size / 2.0f, color); break;
-        case MOD_SCORE_BONUS: DrawRectangleV({ position.x - size / 2, position.y - size / 2 }, { size, size }, color); break;
-        default: DrawCircleV(position, size / 2.0f, color); break; // Default draw as circle
-        }
-    }
+Vector2 Modifier::GetDrawPosition(float alpha) const {
+    return {
+        prevPosition.x + (position.x - prevPosition.x) * alpha,
+        prevPosition.y + (position.y - prevPosition.y) * alpha
+    };
 }
 
 Rectangle Modifier::GetRect() const {
@@ -7,6 +7,7 @@
 class Modifier {
 public:
     Vector2 position;
+    Vector2 prevPosition; // Position at the start of the last tick, used for render interpolation
     Vector2 velocity;
     ModifierType type;
     bool active;
@@ -16,8 +17,8 @@ public:
     Modifier(); 
 
     void Init(Vector2 pos, ModifierType t);
-    void Update();
-    void Draw() const;
+    void Update(float dt);
+    Vector2 GetDrawPosition(float alpha) const;
     Rectangle GetRect() const;
 };
 
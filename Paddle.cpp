@@ -4,12 +4,14 @@
 
 MovingObject::MovingObject() :
     recPosition{ Vector2{50.0f, 50.0f} },
+    recPrevPosition{ Vector2{50.0f, 50.0f} },
     recSpeed{ Vector2{1.0f, 1.0f} }
 {
 }
 
 MovingObject::MovingObject(Vector2 position, Vector2 speed) :
     recPosition{ position },
+    recPrevPosition{ position },
     recSpeed{ speed }
 {
 }
@@ -23,6 +25,11 @@ Vector2 MovingObject::GetPosition() const
     return recPosition;
 }
 
+Vector2 MovingObject::GetPreviousPosition() const
+{
+    return recPrevPosition;
+}
+
 void MovingObject::SetPosition(Vector2 position)
 {
     recPosition = position;
@@ -41,13 +48,15 @@ void MovingObject::SetSpeed(Vector2 speed)
 void MovingObject::Init(Vector2 position, Vector2 speed)
 {
     recPosition = position;
+    recPrevPosition = position;
     recSpeed = speed;
 }
 
-void MovingObject::Update()
+void MovingObject::Update(float dt)
 {
-    recPosition.x += recSpeed.x;
-    recPosition.y += recSpeed.y;
+    recPrevPosition = recPosition;
+    recPosition.x += recSpeed.x * dt;
+    recPosition.y += recSpeed.y * dt;
 }
 
 // ------------------------ Paddle Implementation ------------------------
@@ -80,10 +89,23 @@ void Paddle::Init(Vector2 position, Vector2 speed, float width, float height, Co
     recColor = color;
 }
 
-void Paddle::Draw() const
+Vector2 Paddle::GetDrawPosition(float alpha) const
+{
+    return Vector2{
+        recPrevPosition.x + (recPosition.x - recPrevPosition.x) * alpha,
+        recPrevPosition.y + (recPosition.y - recPrevPosition.y) * alpha
+    };
+}
+
+// The previous position is clamped as well, or interpolation would start from behind a wall
+void Paddle::ClampToField(float fieldWidth)
 {
-    DrawRectangle(static_cast<int>(recPosition.x), static_cast<int>(recPosition.y),
-        static_cast<int>(recWidth), static_cast<int>(recHeight), recColor);
+    const float maxX = fieldWidth - recWidth;
+    if (recPosition.x <= 0.0f) recPosition.x = 0.0f;
+    else if (recPosition.x >= maxX) recPosition.x = maxX;
+
+    if (recPrevPosition.x < 0.0f) recPrevPosition.x = 0.0f;
+    else if (recPrevPosition.x > maxX) recPrevPosition.x = maxX;
 }
 
 Rectangle Paddle::GetPaddleRectangle() const
@@ -100,3 +122,8 @@ float Paddle::GetHeight() const
 {
     return recHeight;
 }
+
+Color Paddle::GetColor() const
+{
+    return recColor;
+}
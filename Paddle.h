@@ -10,16 +10,18 @@ public:
     virtual ~MovingObject();
 
     Vector2 GetPosition() const;
+    Vector2 GetPreviousPosition() const;
     void SetPosition(Vector2 position);
     Vector2 GetSpeed() const;
     void SetSpeed(Vector2 speed);
 
    
     void Init(Vector2 position, Vector2 speed);
-    virtual void Update();
+    virtual void Update(float dt);
 
 protected:
     Vector2 recPosition;
+    Vector2 recPrevPosition; // Position at the start of the last tick
     Vector2 recSpeed;
 };
 
@@ -31,11 +33,13 @@ public:
 
     void Init(Vector2 position, Vector2 speed, float width, float height, Color color);
 
-    void Draw() const;
+    Vector2 GetDrawPosition(float alpha) const;
+    void ClampToField(float fieldWidth); // Keeps the current and previous position between the walls
 
     Rectangle GetPaddleRectangle() const;
     float GetWidth() const;
     float GetHeight() const;
+    Color GetColor() const;
 
 private:
     float recWidth;
@@ -0,0 +1,168 @@
+#include "Profiler.h"
+#include <algorithm> // For std::sort, std::min
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+bool IsProfilerCompiledIn() {
+    return BRICKBREAKER_PROFILE != 0;
+}
+
+#if !PROFILER_USE_TSC
+uint64_t ProfilerTimestamp() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+void SetProfilerThread() {
+    ProfilerThreadState& thread = GetProfilerThreadState();
+    thread.active = true;
+    thread.depth = 0;
+    thread.zone = -1;
+}
+
+#if BRICKBREAKER_PROFILE
+
+ProfileZoneFrame profileZoneFrames[MAX_PROFILE_ZONES];
+
+namespace {
+
+struct ZoneHistory {
+    float ms[PROFILER_HISTORY_FRAMES]; // Ring, one entry per frame
+    float lastMs;
+    int lastCalls;
+};
+
+std::mutex registerMutex;
+std::atomic<int> zoneCount(0); // Published after the zone's slot is filled in
+ZoneHistory zoneHistories[MAX_PROFILE_ZONES];
+int historyHead = 0;   // Next slot to write
+int historyFrames = 0; // Valid entries, up to PROFILER_HISTORY_FRAMES
+
+// Calibration of the raw timestamp against steady_clock, from the first frame onwards
+uint64_t calibrationTicks = 0;
+std::chrono::steady_clock::time_point calibrationTime;
+uint64_t lastFrameTicks = 0;
+double msPerTick = 0.0;
+float frameMs = 0.0f;
+
+} // namespace
+
+int RegisterProfileZone(const char* name) {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    // The last slot is shared by every zone past the limit so PROFILE_ZONE never fails
+    int id = zoneCount.load(std::memory_order_relaxed);
+    if (id >= MAX_PROFILE_ZONES) return MAX_PROFILE_ZONES - 1;
+    if (id == MAX_PROFILE_ZONES - 1) name = "(other zones)";
+
+    profileZoneFrames[id].name = name;
+    profileZoneFrames[id].depth = -1;
+    profileZoneFrames[id].parent = -1;
+    zoneCount.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+void ProfilerEndFrame() {
+    uint64_t now = ProfilerTimestamp();
+    auto wallNow = std::chrono::steady_clock::now();
+
+#if PROFILER_USE_TSC
+    if (calibrationTicks == 0) {
+        calibrationTicks = now;
+        calibrationTime = wallNow;
+    }
+    else {
+        double elapsedMs = std::chrono::duration<double, std::milli>(wallNow - calibrationTime).count();
+        if (now > calibrationTicks && elapsedMs > 0.0) msPerTick = elapsedMs / (double)(now - calibrationTicks);
+    }
+#else
+    (void)wallNow;
+    msPerTick = 1e-6;
+#endif
+
+    frameMs = lastFrameTicks != 0 ? (float)((now - lastFrameTicks) * msPerTick) : 0.0f;
+    lastFrameTicks = now;
+
+    // Worker threads may register zones meanwhile; they never record into them
+    int count = GetProfileZoneCount();
+    for (int i = 0; i < count; ++i) {
+        ProfileZoneFrame& frame = profileZoneFrames[i];
+        ZoneHistory& history = zoneHistories[i];
+        history.lastMs = (float)(frame.ticks * msPerTick);
+        history.lastCalls = frame.calls;
+        history.ms[historyHead] = history.lastMs;
+        frame.ticks = 0;
+        frame.calls = 0;
+    }
+    historyHead = (historyHead + 1) % PROFILER_HISTORY_FRAMES;
+    historyFrames = std::min(historyFrames + 1, PROFILER_HISTORY_FRAMES);
+}
+
+int GetProfileZoneCount() {
+    return zoneCount.load(std::memory_order_acquire);
+}
+
+// Registration order is the order zones are first reached, which isn't tree order when a
+// child is first entered in a later frame than its siblings, so walk the recorded parents
+static int AppendZoneSubtree(int parent, int count, int* zones, int written) {
+    for (int i = 0; i < count && written < count; ++i) {
+        if (profileZoneFrames[i].parent != parent || i == parent) continue;
+        zones[written++] = i;
+        written = AppendZoneSubtree(i, count, zones, written);
+    }
+    return written;
+}
+
+int GetProfileZoneOrder(int* zones) {
+    return AppendZoneSubtree(-1, GetProfileZoneCount(), zones, 0);
+}
+
+bool GetProfileZoneStats(int zone, ProfileZoneStats* stats) {
+    if (zone < 0 || zone >= GetProfileZoneCount() || historyFrames == 0) return false;
+
+    const ZoneHistory& history = zoneHistories[zone];
+    float sorted[PROFILER_HISTORY_FRAMES];
+    std::copy(history.ms, history.ms + historyFrames, sorted);
+    std::sort(sorted, sorted + historyFrames);
+
+    float sum = 0.0f;
+    for (int i = 0; i < historyFrames; ++i) sum += sorted[i];
+
+    stats->name = profileZoneFrames[zone].name;
+    stats->parent = profileZoneFrames[zone].parent;
+    stats->depth = 0;
+    for (int p = stats->parent; p >= 0 && stats->depth < MAX_PROFILE_ZONES; p = profileZoneFrames[p].parent) stats->depth++;
+    stats->calls = history.lastCalls;
+    stats->lastMs = history.lastMs;
+    stats->minMs = sorted[0];
+    stats->avgMs = sum / historyFrames;
+    stats->p99Ms = sorted[std::min(historyFrames - 1, (historyFrames * 99) / 100)];
+    return true;
+}
+
+float GetProfilerFrameMs() {
+    return frameMs;
+}
+
+int GetProfilerHistoryFrames() {
+    return historyFrames;
+}
+
+float GetProfileZoneHistoryMs(int zone, int framesAgo) {
+    if (zone < 0 || zone >= GetProfileZoneCount() || framesAgo < 0 || framesAgo >= historyFrames) return 0.0f;
+    int slot = (historyHead - 1 - framesAgo + PROFILER_HISTORY_FRAMES) % PROFILER_HISTORY_FRAMES;
+    return zoneHistories[zone].ms[slot];
+}
+
+#else
+
+void ProfilerEndFrame() {}
+int GetProfileZoneCount() { return 0; }
+int GetProfileZoneOrder(int*) { return 0; }
+bool GetProfileZoneStats(int, ProfileZoneStats*) { return false; }
+float GetProfilerFrameMs() { return 0.0f; }
+int GetProfilerHistoryFrames() { return 0; }
+float GetProfileZoneHistoryMs(int, int) { return 0.0f; }
+
+#endif // BRICKBREAKER_PROFILE
@@ -0,0 +1,149 @@
+#pragma once
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include "FrameTrace.h"
+
+//------------------------------------------------------------------------------------
+// Frame profiler with scoped zones
+// PROFILE_ZONE("name") times the rest of the enclosing scope. Each zone keeps its total
+// time per frame for the last PROFILER_HISTORY_FRAMES frames, from which the overlay
+// shows min/avg/p99. Zones nest: each remembers the zone it was first entered inside, and
+// GetProfileZoneOrder() lists them as that tree for the overlay.
+//
+// Only the thread that called SetProfilerThread() records. Zones hit on any other thread
+// (batch simulator and VecEnv workers run the same Simulation code) cost one
+// thread-local test. Timestamps are the CPU cycle counter on x86, calibrated against
+// steady_clock at every ProfilerEndFrame().
+//
+// While a frame trace is recording (FrameTrace.h) every zone is also written to it.
+//
+// Build with BRICKBREAKER_PROFILE=0 to compile the zones out entirely; the query
+// functions stay available and report no zones.
+//------------------------------------------------------------------------------------
+#ifndef BRICKBREAKER_PROFILE
+    #define BRICKBREAKER_PROFILE 1
+#endif
+
+const int MAX_PROFILE_ZONES = 32;
+const int PROFILER_HISTORY_FRAMES = 240; // One second at 240 fps, 1.7 s at 144
+
+struct ProfileZoneStats {
+    const char* name;
+    int parent;      // Zone it was first entered inside, -1 at the top level
+    int depth;       // Levels below the top in that tree
+    int calls;       // Times entered during the last frame
+    float lastMs;    // Last frame
+    float minMs;
+    float avgMs;
+    float p99Ms;
+};
+
+void SetProfilerThread();  // Record zones entered on the calling thread (the main loop)
+void ProfilerEndFrame();   // Closes the frame: pushes every zone's total into its history
+int GetProfileZoneCount();
+int GetProfileZoneOrder(int* zones); // Zone ids depth-first, children after their parent; returns the count
+bool GetProfileZoneStats(int zone, ProfileZoneStats* stats);
+float GetProfilerFrameMs(); // Time between the last two ProfilerEndFrame() calls
+int GetProfilerHistoryFrames(); // Frames held in the history, up to PROFILER_HISTORY_FRAMES
+float GetProfileZoneHistoryMs(int zone, int framesAgo); // 0 is the last finished frame
+bool IsProfilerCompiledIn();
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define PROFILER_USE_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define PROFILER_USE_TSC 1
+#else
+    #define PROFILER_USE_TSC 0
+#endif
+
+// Raw timestamp: cycles where the counter is available, steady_clock nanoseconds elsewhere
+#if PROFILER_USE_TSC
+inline uint64_t ProfilerTimestamp() { return __rdtsc(); }
+#else
+uint64_t ProfilerTimestamp();
+#endif
+
+struct ProfilerThreadState {
+    bool active; // Set by SetProfilerThread()
+    int depth;   // Zones currently open on this thread
+    int zone;    // Innermost open zone, -1 when none
+};
+
+// Function-local and constant-initialized, so access is a plain TLS load instead of a call
+// through the wrapper an extern thread_local needs
+inline ProfilerThreadState& GetProfilerThreadState() {
+    static thread_local ProfilerThreadState state = { false, 0, -1 };
+    return state;
+}
+
+#if BRICKBREAKER_PROFILE
+
+struct ProfileZoneFrame {
+    const char* name;
+    uint64_t ticks; // Accumulated this frame
+    int calls;
+    int depth;      // -1 until first entered
+    int parent;     // Innermost open zone at the first entry, -1 at the top level
+};
+
+extern ProfileZoneFrame profileZoneFrames[MAX_PROFILE_ZONES];
+
+int RegisterProfileZone(const char* name); // Once per PROFILE_ZONE site, thread-safe
+
+class ProfileScope {
+public:
+    explicit ProfileScope(int zoneId) : zone(zoneId), outer(-1), start(0) {
+        ProfilerThreadState& thread = GetProfilerThreadState();
+        if (!thread.active) {
+            zone = -1;
+            return;
+        }
+        ProfileZoneFrame& frame = profileZoneFrames[zone];
+        if (frame.depth < 0) {
+            frame.depth = thread.depth;
+            // The shared overflow slot stays top level: with a parent it could end up below its own children
+            frame.parent = (zone == MAX_PROFILE_ZONES - 1) ? -1 : thread.zone;
+        }
+        outer = thread.zone;
+        thread.zone = zone;
+        thread.depth++;
+        start = ProfilerTimestamp();
+    }
+    ~ProfileScope() {
+        if (zone < 0) return;
+        uint64_t end = ProfilerTimestamp();
+        ProfileZoneFrame& frame = profileZoneFrames[zone];
+        frame.ticks += end - start;
+        frame.calls++;
+        ProfilerThreadState& thread = GetProfilerThreadState();
+        thread.zone = outer;
+        thread.depth--;
+        if (IsFrameTraceRecording()) WriteTraceEvent(frame.name, start, end);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int zone;
+    int outer; // Zone that was open when this one started
+    uint64_t start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) \
+    static const int PROFILE_CONCAT(profileZoneId, __LINE__) = RegisterProfileZone(name); \
+    ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileZoneId, __LINE__))
+
+#else
+
+#define PROFILE_ZONE(name) ((void)0)
+
+#endif // BRICKBREAKER_PROFILE
+
+#endif // PROFILER_H
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+//------------------------------------------------------------------------------------
+// PCG32 random stream (pcg32_random_r, O'Neill)
+// 16 bytes of state per stream, no globals, so every Simulation carries its own and
+// any number of them can run side by side. The same seed and stream id give the same
+// sequence on every platform and compiler, unlike rand().
+// Different stream ids with the same seed produce independent sequences, which is how
+// gameplay and cosmetic randomness are kept apart.
+//------------------------------------------------------------------------------------
+class Random {
+public:
+    Random() { Seed(0); }
+    explicit Random(uint64_t seed, uint64_t stream = 0) { Seed(seed, stream); }
+
+    void Seed(uint64_t seed, uint64_t stream = 0) {
+        state = 0;
+        increment = (stream << 1) | 1;
+        NextU32();
+        state += seed;
+        NextU32();
+    }
+
+    uint32_t NextU32() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        uint32_t xorShifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+        uint32_t rot = (uint32_t)(old >> 59);
+        return (xorShifted >> rot) | (xorShifted << ((0u - rot) & 31));
+    }
+
+    // Uniform in [0, bound), without modulo bias
+    uint32_t NextBelow(uint32_t bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        for (;;) {
+            uint32_t r = NextU32();
+            if (r >= threshold) return r % bound;
+        }
+    }
+
+    // Uniform integer in [min, max], bounds may come in either order (as GetRandomValue)
+    int Range(int min, int max) {
+        if (min > max) {
+            int tmp = max;
+            max = min;
+            min = tmp;
+        }
+        uint32_t span = (uint32_t)((int64_t)max - min + 1);
+        if (span == 0) return (int)NextU32(); // Full int range
+        return (int)((uint32_t)min + NextBelow(span));
+    }
+
+    // Uniform float in [0, 1)
+    float NextFloat() { return (float)(NextU32() >> 8) * (1.0f / 16777216.0f); }
+
+    // Raw generator state, for checksums that must catch streams drifting apart
+    uint64_t GetState() const { return state; }
+    uint64_t GetIncrement() const { return increment; }
+
+private:
+    uint64_t state;
+    uint64_t increment; // Stream selector, always odd
+};
+
+#endif // RANDOM_H
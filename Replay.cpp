@@ -0,0 +1,263 @@
+#include "Replay.h"
+#include <cmath>   // For std::isfinite
+#include <cstdio>
+#include <cstring> // For memcpy, memcmp
+
+static const unsigned char REPLAY_MAGIC[4] = { 'B', 'B', 'R', 'P' };
+static const int REPLAY_MAX_BRICK_DIMENSION = 1000; // Per side; real layouts are a few dozen at most
+
+// Byte writers/readers, little-endian regardless of the host
+static void PutU32(std::vector<unsigned char>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out.push_back((unsigned char)(value >> (8 * i)));
+}
+
+static void PutF32(std::vector<unsigned char>& out, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    PutU32(out, bits);
+}
+
+static void PutVarint(std::vector<unsigned char>& out, unsigned long long value) {
+    while (value >= 0x80) {
+        out.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((unsigned char)value);
+}
+
+static bool GetU32(const std::vector<unsigned char>& in, size_t& pos, uint32_t& value) {
+    if (pos > in.size() || in.size() - pos < 4) return false;
+    value = 0;
+    for (int i = 0; i < 4; ++i) value |= (uint32_t)in[pos + i] << (8 * i);
+    pos += 4;
+    return true;
+}
+
+static bool GetF32(const std::vector<unsigned char>& in, size_t& pos, float& value) {
+    uint32_t bits;
+    if (!GetU32(in, pos, bits)) return false;
+    memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+static bool GetI32(const std::vector<unsigned char>& in, size_t& pos, int& value) {
+    uint32_t bits;
+    if (!GetU32(in, pos, bits)) return false;
+    value = (int)bits;
+    return true;
+}
+
+static bool GetVarint(const std::vector<unsigned char>& in, size_t& pos, unsigned long long& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+        unsigned char byte = in[pos++];
+        value |= (unsigned long long)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false; // Truncated or longer than 64 bits
+}
+
+static unsigned char PackInput(const SimInput& input) {
+    return (unsigned char)((input.moveLeft ? 1 : 0) | (input.moveRight ? 2 : 0));
+}
+
+static bool ReadRowLives(const std::vector<unsigned char>& in, size_t& pos, int* rowLives) {
+    for (int r = 0; r < CONFIG_ROW_LIVES; ++r) {
+        if (!GetI32(in, pos, rowLives[r])) return false;
+    }
+    return true;
+}
+
+static void WriteConfig(std::vector<unsigned char>& out, const SimConfig& config) {
+    PutF32(out, config.fieldWidth);
+    PutF32(out, config.fieldHeight);
+    PutU32(out, (uint32_t)config.brickRows);
+    PutU32(out, (uint32_t)config.brickColumns);
+    PutF32(out, config.brickWidth);
+    PutF32(out, config.brickHeight);
+    PutF32(out, config.brickGap);
+    PutF32(out, config.brickTopOffset);
+    PutU32(out, (uint32_t)config.maxBalls);
+    PutF32(out, config.modifierChance);
+    PutF32(out, config.paddleBounceMultiplier);
+    for (int r = 0; r < CONFIG_ROW_LIVES; ++r) PutU32(out, (uint32_t)config.rowLives[r]);
+}
+
+static bool ReadConfig(const std::vector<unsigned char>& in, size_t& pos, SimConfig& config) {
+    return GetF32(in, pos, config.fieldWidth) &&
+        GetF32(in, pos, config.fieldHeight) &&
+        GetI32(in, pos, config.brickRows) &&
+        GetI32(in, pos, config.brickColumns) &&
+        GetF32(in, pos, config.brickWidth) &&
+        GetF32(in, pos, config.brickHeight) &&
+        GetF32(in, pos, config.brickGap) &&
+        GetF32(in, pos, config.brickTopOffset) &&
+        GetI32(in, pos, config.maxBalls) &&
+        GetF32(in, pos, config.modifierChance) &&
+        GetF32(in, pos, config.paddleBounceMultiplier) &&
+        ReadRowLives(in, pos, config.rowLives);
+}
+
+// Rejects configs from damaged or hostile files that would make the simulation allocate or loop without bound
+static bool IsPositiveFinite(float value) {
+    return std::isfinite(value) && value > 0.0f;
+}
+
+static bool IsPlayableConfig(const SimConfig& config) {
+    return IsPositiveFinite(config.fieldWidth) && IsPositiveFinite(config.fieldHeight) &&
+        config.brickRows > 0 && config.brickRows <= REPLAY_MAX_BRICK_DIMENSION &&
+        config.brickColumns > 0 && config.brickColumns <= REPLAY_MAX_BRICK_DIMENSION &&
+        config.maxBalls >= 1;
+}
+
+//------------------------------------------------------------------------------------
+// ReplayRecorder
+//------------------------------------------------------------------------------------
+ReplayRecorder::ReplayRecorder()
+    : tickCount(0), runLength(0), runInput(0), seed(0), config(DefaultSimConfig()), recording(false) {}
+
+void ReplayRecorder::Begin(unsigned int randomSeed, const SimConfig& simConfig) {
+    runs.clear();
+    tickCount = 0;
+    runLength = 0;
+    runInput = 0;
+    seed = randomSeed;
+    config = simConfig;
+    recording = true;
+}
+
+void ReplayRecorder::Record(const SimInput& input) {
+    if (!recording) return;
+
+    unsigned char bits = PackInput(input);
+    if (runLength > 0 && bits != runInput) {
+        PutVarint(runs, (runLength << 2) | runInput);
+        runLength = 0;
+    }
+    runInput = bits;
+    runLength++;
+    tickCount++;
+}
+
+void ReplayRecorder::Stop() {
+    recording = false;
+}
+
+void ReplayRecorder::Serialize(const Simulation& simulation, std::vector<unsigned char>& out) const {
+    out.clear();
+    out.reserve(64 + runs.size() + 32);
+
+    out.insert(out.end(), REPLAY_MAGIC, REPLAY_MAGIC + 4);
+    out.push_back((unsigned char)(REPLAY_VERSION & 0xFF));
+    out.push_back((unsigned char)(REPLAY_VERSION >> 8));
+    PutU32(out, seed);
+    PutF32(out, SIM_TICK_RATE);
+    WriteConfig(out, config);
+
+    // The open run is flushed into the copy only, recording can carry on after a save
+    out.insert(out.end(), runs.begin(), runs.end());
+    if (runLength > 0) PutVarint(out, (runLength << 2) | runInput);
+    PutVarint(out, 0);
+
+    PutVarint(out, tickCount);
+    PutU32(out, (uint32_t)simulation.score);
+    PutU32(out, simulation.Checksum());
+}
+
+bool ReplayRecorder::Save(const char* fileName, const Simulation& simulation) const {
+    std::vector<unsigned char> bytes;
+    Serialize(simulation, bytes);
+
+    FILE* file = fopen(fileName, "wb");
+    if (file == NULL) return false;
+    bool written = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    return (fclose(file) == 0) && written;
+}
+
+//------------------------------------------------------------------------------------
+// ReplayPlayer
+//------------------------------------------------------------------------------------
+ReplayPlayer::ReplayPlayer()
+    : runsStart(0), cursor(0), runRemaining(0), runInput(0), seed(0), tickRate(SIM_TICK_RATE),
+    config(DefaultSimConfig()), tickCount(0), finalScore(0), finalChecksum(0) {}
+
+bool ReplayPlayer::Load(const char* fileName) {
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL) return false;
+
+    std::vector<unsigned char> bytes;
+    unsigned char chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        bytes.insert(bytes.end(), chunk, chunk + read);
+    }
+    bool failed = ferror(file) != 0;
+    fclose(file);
+
+    return !failed && LoadFromMemory(bytes.data(), bytes.size());
+}
+
+bool ReplayPlayer::LoadFromMemory(const unsigned char* bytes, size_t size) {
+    data.assign(bytes, bytes + size);
+
+    size_t pos = 0;
+    if (data.size() < 6 || memcmp(data.data(), REPLAY_MAGIC, 4) != 0) return false;
+    uint16_t version = (uint16_t)(data[4] | (data[5] << 8));
+    if (version != REPLAY_VERSION) return false;
+    pos = 6;
+
+    uint32_t seedBits;
+    if (!GetU32(data, pos, seedBits) || !GetF32(data, pos, tickRate) || !ReadConfig(data, pos, config)) return false;
+    if (!IsPositiveFinite(tickRate) || !IsPlayableConfig(config)) return false;
+    seed = seedBits;
+    runsStart = pos;
+
+    // Walk the runs once to find the footer and check they add up to its tick count
+    unsigned long long run;
+    unsigned long long ticks = 0;
+    do {
+        if (!GetVarint(data, pos, run)) return false;
+        ticks += run >> 2;
+    } while (run != 0);
+
+    uint32_t checksum;
+    if (!GetVarint(data, pos, tickCount) || !GetI32(data, pos, finalScore) || !GetU32(data, pos, checksum)) return false;
+    if (ticks != tickCount) return false;
+    finalChecksum = checksum;
+
+    Rewind();
+    return true;
+}
+
+bool ReplayPlayer::NextInput(SimInput& input) {
+    while (runRemaining == 0) {
+        unsigned long long run;
+        if (!GetVarint(data, cursor, run) || run == 0) return false;
+        runRemaining = run >> 2;
+        runInput = (unsigned char)(run & 3);
+    }
+
+    runRemaining--;
+    input.moveLeft = (runInput & 1) != 0;
+    input.moveRight = (runInput & 2) != 0;
+    return true;
+}
+
+void ReplayPlayer::Rewind() {
+    cursor = runsStart;
+    runRemaining = 0;
+    runInput = 0;
+}
+
+bool ReplayPlayer::Run(Simulation& simulation) {
+    Rewind();
+    simulation.Init(seed, config);
+
+    const float dt = 1.0f / tickRate;
+    SimInput input;
+    while (NextInput(input)) {
+        simulation.Step(input, dt);
+    }
+
+    return simulation.score == finalScore && simulation.Checksum() == finalChecksum;
+}
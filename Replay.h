@@ -0,0 +1,88 @@
+#pragma once
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <vector>
+#include <cstddef> // For size_t
+#include <cstdint>
+#include "Simulation.h"
+
+//------------------------------------------------------------------------------------
+// Replay files
+// A session is fully determined by its SimConfig, its random seed and the input of every
+// tick, so that is all a replay holds. Keys stay down for hundreds of ticks at a time,
+// so input is stored as runs: one varint per run, (ticks << 2) | input bits, usually one
+// or two bytes for a whole keypress. An hour of play is a few kilobytes.
+//
+// Layout, integers little-endian:
+//   "BBRP"  u16 version  u32 seed  f32 tick rate  SimConfig (f32/i32 fields in declaration order,
+//   rowLives as CONFIG_ROW_LIVES i32)
+//   runs...  varint 0 (end of input)
+//   varint tick count  i32 final score  u32 final Simulation::Checksum()
+// The footer lets playback check it reproduced the recorded session exactly.
+//------------------------------------------------------------------------------------
+
+const uint16_t REPLAY_VERSION = 4; // 3: balance fields in SimConfig, 4: Checksum() covers the random stream
+
+class ReplayRecorder {
+public:
+    ReplayRecorder();
+
+    void Begin(unsigned int seed, const SimConfig& config); // Call right after Simulation::Init
+    void Record(const SimInput& input);                    // Once per Simulation::Step, before it
+    void Stop();
+
+    // Writes everything recorded so far; simulation must be the one being recorded, its
+    // state after the last recorded tick goes in the footer. Can be called mid-session.
+    bool Save(const char* fileName, const Simulation& simulation) const;
+    void Serialize(const Simulation& simulation, std::vector<unsigned char>& out) const;
+
+    bool IsRecording() const { return recording; }
+    unsigned long long GetTickCount() const { return tickCount; }
+
+private:
+    std::vector<unsigned char> runs; // Closed runs, already encoded
+    unsigned long long tickCount;
+    unsigned long long runLength;    // Ticks in the open run
+    unsigned char runInput;          // Input bits of the open run
+    unsigned int seed;
+    SimConfig config;
+    bool recording;
+};
+
+class ReplayPlayer {
+public:
+    ReplayPlayer();
+
+    bool Load(const char* fileName);
+    bool LoadFromMemory(const unsigned char* bytes, size_t size); // False if the header or footer is malformed
+
+    unsigned int GetSeed() const { return seed; }
+    float GetTickRate() const { return tickRate; }
+    const SimConfig& GetConfig() const { return config; }
+    unsigned long long GetTickCount() const { return tickCount; }
+    int GetFinalScore() const { return finalScore; }
+    uint32_t GetFinalChecksum() const { return finalChecksum; }
+
+    bool NextInput(SimInput& input); // Input for the next tick, false once the recording ends
+    void Rewind();
+
+    // Inits simulation from the header and plays every tick. True if the final state
+    // matches the recorded checksum.
+    bool Run(Simulation& simulation);
+
+private:
+    std::vector<unsigned char> data;
+    size_t runsStart;   // Offset of the first run
+    size_t cursor;      // Offset of the next run to decode
+    unsigned long long runRemaining;
+    unsigned char runInput;
+    unsigned int seed;
+    float tickRate;
+    SimConfig config;
+    unsigned long long tickCount;
+    int finalScore;
+    uint32_t finalChecksum;
+};
+
+#endif // REPLAY_H
@@ -0,0 +1,39 @@
+#include "SimBot.h"
+
+BotConfig DefaultBotConfig() {
+    BotConfig config;
+    config.reactionTime = 0.12f;
+    config.aimError = 70.0f;
+    config.deadZone = 20.0f;
+    return config;
+}
+
+SimBot::SimBot() : config(DefaultBotConfig()), nextDecisionTime(0.0f), targetX(0.0f) {}
+
+void SimBot::Init(const BotConfig& botConfig, unsigned int seed) {
+    config = botConfig;
+    random.Seed(seed, BOT_RANDOM_STREAM);
+    nextDecisionTime = 0.0f;
+    targetX = -1.0f;
+}
+
+SimInput SimBot::Think(const Simulation& simulation) {
+    float paddleCenter = simulation.paddle.GetPosition().x + simulation.paddle.GetWidth() / 2.0f;
+
+    if (simulation.gameTimer >= nextDecisionTime) {
+        nextDecisionTime = simulation.gameTimer + config.reactionTime;
+
+        // Lowest ball is the most urgent one
+        int lowest = -1;
+        for (int i = 0; i < simulation.balls.Count(); ++i) {
+            if (lowest < 0 || simulation.balls.y[i] > simulation.balls.y[lowest]) lowest = i;
+        }
+        float error = (random.NextFloat() * 2.0f - 1.0f) * config.aimError;
+        targetX = (lowest >= 0) ? simulation.balls.x[lowest] + error : paddleCenter;
+    }
+
+    SimInput input;
+    input.moveLeft = targetX < paddleCenter - config.deadZone;
+    input.moveRight = targetX > paddleCenter + config.deadZone;
+    return input;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef SIM_BOT_H
+#define SIM_BOT_H
+
+#include "Simulation.h"
+#include "Random.h"
+
+//------------------------------------------------------------------------------------
+// Scripted paddle player for headless runs
+// Chases the lowest ball, but only looks at the field every reactionTime seconds and
+// aims a random distance (up to aimError) off the ball, so it misses now and then and
+// rounds end. With its own random stream the same seed always plays the same game.
+//------------------------------------------------------------------------------------
+struct BotConfig {
+    float reactionTime; // Seconds between target updates
+    float aimError;     // Max horizontal aiming error (px) picked at each update
+    float deadZone;     // Paddle stops when its centre is this close to the target (px)
+};
+
+BotConfig DefaultBotConfig();
+
+class SimBot {
+public:
+    SimBot();
+
+    void Init(const BotConfig& botConfig, unsigned int seed);
+    SimInput Think(const Simulation& simulation); // Input for the next tick
+
+private:
+    BotConfig config;
+    Random random;
+    float nextDecisionTime; // simulation.gameTimer value of the next target update
+    float targetX;
+};
+
+#endif // SIM_BOT_H
@@ -0,0 +1,419 @@
+#include "Simulation.h"
+#include "Collision.h"
+#include "Profiler.h"
+#include <cmath>
+#include <algorithm> // For std::remove_if
+
+SimConfig DefaultSimConfig() {
+    SimConfig config;
+    config.fieldWidth = (float)WINDOW_WIDTH;
+    config.fieldHeight = (float)WINDOW_HEIGHT;
+    config.brickRows = BRICK_ROWS;
+    config.brickColumns = BRICK_COLUMNS;
+    config.brickWidth = BRICK_WIDTH;
+    config.brickHeight = BRICK_HEIGHT;
+    config.brickGap = BRICK_GAP;
+    config.brickTopOffset = BRICK_TOP_OFFSET;
+    config.maxBalls = MAX_BALLS;
+    config.modifierChance = MODIFIER_CHANCE;
+    config.paddleBounceMultiplier = PADDLE_BOUNCE_MULTIPLIER;
+    for (int r = 0; r < CONFIG_ROW_LIVES; ++r) {
+        config.rowLives[r] = 1;
+        if (r < 1) config.rowLives[r] = 3;       // Top row gets 3 lives
+        else if (r < 3) config.rowLives[r] = 2; // Next two rows get 2 lives
+    }
+    return config;
+}
+
+Simulation::Simulation() : config(DefaultSimConfig()), score(0), gameTimer(0.0f), gameOver(false), seed(0) {}
+
+// Initialize/Reset Game State
+void Simulation::Init(unsigned int randomSeed, const SimConfig& simConfig) {
+    // Reset game variables
+    config = simConfig;
+    seed = randomSeed;
+    random.Seed(seed, SIM_RANDOM_STREAM);
+    score = 0;
+    gameTimer = 0.0f;
+    gameOver = false;
+    balls.Clear();
+    modifiers.clear();
+    events.clear();
+
+    // Initialize Paddle
+    paddle.Init(
+        { (config.fieldWidth / 2.0f) - (PADDLE_W / 2.0f), config.fieldHeight * 0.9f },
+        { 0.0f, 0.0f }, // Initial speed (zero)
+        PADDLE_W,
+        PADDLE_HE,
+        SKYBLUE);
+
+    // Initialize Ball(s)
+    balls.Add(
+        { config.fieldWidth / 2.0f, paddle.GetPosition().y - PADDLE_H - BALL_RADIUS - 5 },
+        INITIAL_BALL_SPEED,
+        BALL_RADIUS,
+        Color{ 2, 222, 233, 242 }
+    );
+
+    // Initialize Bricks
+    ResetBricks();
+}
+
+// Function to Reset/Initialize Bricks
+void Simulation::ResetBricks() {
+    bricks.Init(config.brickRows, config.brickColumns,
+        config.brickGap, config.brickGap + config.brickTopOffset,
+        config.brickWidth, config.brickHeight, config.brickGap);
+
+    for (int r = 0; r < config.brickRows; ++r) {
+        // Determine lives based on row
+        int lives = config.rowLives[r < CONFIG_ROW_LIVES ? r : CONFIG_ROW_LIVES - 1];
+
+        for (int c = 0; c < config.brickColumns; ++c) {
+            bricks.SetLives(r, c, lives);
+        }
+    }
+}
+
+// Advance the game by exactly one fixed tick
+void Simulation::Step(const SimInput& input, float dt) {
+    PROFILE_ZONE("Sim step");
+    events.clear();
+    if (gameOver) return;
+
+    gameTimer += dt;
+
+    // Paddle Input and Movement
+    if (input.moveRight)
+        paddle.SetSpeed(Vector2{ PADDLE_SPEED, 0.0f });
+    else if (input.moveLeft)
+        paddle.SetSpeed(Vector2{ -PADDLE_SPEED, 0.0f });
+    else
+        paddle.SetSpeed(Vector2{ paddle.GetSpeed().x * expf(-PADDLE_DECELERATION * dt), 0.0f });
+
+    paddle.Update(dt); // Update paddle position
+
+    // Paddle Screen Bounds
+    paddle.ClampToField(config.fieldWidth);
+
+
+    // Ball Update (whole pool at once, vectorized). This gives every ball its unobstructed
+    // end position; balls whose path comes near the paddle or bricks are then re-traced below.
+    balls.Integrate(dt);
+
+    // Ball vs Paddle/Bricks Collisions
+    const BrickGrid& grid = bricks.GetGrid();
+    const float paddleTop = paddle.GetPosition().y;
+    const float paddleBottom = paddleTop + paddle.GetHeight();
+    const float gridTop = grid.originY;
+    const float gridBottom = grid.originY + grid.rows * grid.pitchY;
+    {
+        PROFILE_ZONE("Ball collisions");
+        for (int i = balls.Count() - 1; i >= 0; --i)
+        {
+            const float br = balls.radius[i];
+
+            // Vertical span covered by the ball this tick; most balls are nowhere near the paddle or bricks
+            float spanTop = fminf(balls.prevY[i], balls.y[i]) - br - 1.0f;
+            float spanBottom = fmaxf(balls.prevY[i], balls.y[i]) + br + 1.0f;
+            bool nearPaddle = spanBottom >= paddleTop && spanTop <= paddleBottom;
+            bool nearBricks = spanBottom >= gridTop && spanTop <= gridBottom;
+
+            if (nearPaddle || nearBricks) {
+                MoveBallSwept(i, dt);
+            }
+
+            // The paddle can also move into a ball from the side, which a sweep of the ball alone won't see
+            if (nearPaddle && balls.vy[i] > 0 &&
+                CircleIntersectsRect(balls.GetPosition(i), br, paddle.GetPaddleRectangle())) {
+                BounceOffPaddle(i);
+            }
+        } // End ball loop
+    }
+
+    // Ball vs Walls (vectorized). Balls that fell below the bottom become inactive;
+    // don't set game over yet, wait until all balls are checked
+    balls.ReflectWalls(config.fieldWidth, config.fieldHeight);
+
+    // Modifier Update and Collisions
+    {
+        PROFILE_ZONE("Modifiers");
+        for (int i = modifiers.size() - 1; i >= 0; --i) {
+            Modifier& mod = modifiers[i];
+            if (!mod.active) continue;
+
+            mod.Update(dt);
+
+            if (mod.active && RectsIntersect(mod.GetRect(), paddle.GetPaddleRectangle())) {
+                ActivateModifier(mod);
+                mod.active = false;
+                Emit(SIM_EVENT_MODIFIER_COLLECTED, mod.position, mod.type);
+            }
+        }
+    }
+
+    // Cleanup Inactive Objects
+    for (int i = 0; i < balls.Count(); ++i) {
+        if (!balls.active[i]) Emit(SIM_EVENT_BALL_LOST, balls.GetPosition(i));
+    }
+    balls.RemoveInactive();
+    modifiers.erase(std::remove_if(modifiers.begin(), modifiers.end(), [](const Modifier& m) { return !m.active; }), modifiers.end());
+
+    // Check Game Over Condition (No active balls left)
+    if (balls.Empty()) {
+        gameOver = true;
+        Emit(SIM_EVENT_GAME_OVER, { 0.0f, 0.0f });
+        return; // Exit Step early if game is over
+    }
+
+    // Check Win Condition (No active bricks left) -> Reset Level
+    if (!bricks.AnyLive()) {
+        ResetBricks(); // Reset bricks for a new level
+        score += 999999; // Example bonus
+        Emit(SIM_EVENT_LEVEL_CLEARED, { config.fieldWidth / 2.0f, config.fieldHeight / 3.0f }, 999999);
+
+        // Reset ball position and speed (using the first ball if multiple exist)
+        balls.x[0] = config.fieldWidth / 2.0f;
+        balls.y[0] = paddle.GetPosition().y - PADDLE_H - BALL_RADIUS - 5;
+        balls.prevX[0] = balls.x[0]; // Teleport, don't interpolate across the reset
+        balls.prevY[0] = balls.y[0];
+        balls.vx[0] = INITIAL_BALL_SPEED.x; // Reset speed
+        balls.vy[0] = INITIAL_BALL_SPEED.y;
+        // Make sure the first ball is active if somehow it wasn't
+        balls.active[0] = 1;
+        // Remove any other extra balls from multiball etc.
+        balls.Truncate(1);
+    }
+}
+
+// Trace ball i from where it started this tick, stopping at each brick or paddle contact.
+// Several contacts can be resolved in one tick, so fast balls can't skip through thin bricks.
+void Simulation::MoveBallSwept(int i, float dt) {
+    const BrickGrid& grid = bricks.GetGrid();
+    const float br = balls.radius[i];
+    const Rectangle paddleRect = paddle.GetPaddleRectangle();
+    float& bvx = balls.vx[i];
+    float& bvy = balls.vy[i];
+
+    Vector2 pos = { balls.prevX[i], balls.prevY[i] };
+    float timeLeft = dt;
+
+    for (int contact = 0; contact < MAX_BALL_CONTACTS_PER_TICK && timeLeft > 0.0f; ++contact) {
+        Vector2 delta = { bvx * timeLeft, bvy * timeLeft };
+
+        float toi = 1.0f;
+        Vector2 normal = { 0.0f, 0.0f };
+        int hitRow = -1, hitCol = -1;
+        bool hitPaddle = false;
+        float t;
+        Vector2 n;
+
+        // Ball vs Bricks: only the cells under the box swept by the ball can be touched
+        Rectangle sweptBox = {
+            fminf(pos.x, pos.x + delta.x) - br - 1.0f, fminf(pos.y, pos.y + delta.y) - br - 1.0f,
+            fabsf(delta.x) + br * 2.0f + 2.0f, fabsf(delta.y) + br * 2.0f + 2.0f
+        };
+        CellRange cells;
+        if (grid.QueryCells(sweptBox, &cells)) {
+            for (int r = cells.rowMin; r <= cells.rowMax; ++r) {
+                // Walk the live-brick bitset so destroyed bricks cost nothing
+                bricks.ForEachLiveInRow(r, cells.colMin, cells.colMax, [&](int c) {
+                    // Only count surfaces the ball is moving into
+                    if (SweepCircleRect(pos, delta, br, bricks.GetBrickRect(r, c), &t, &n) && t < toi &&
+                        bvx * n.x + bvy * n.y < 0.0f) {
+                        toi = t;
+                        normal = n;
+                        hitRow = r;
+                        hitCol = c;
+                    }
+                });
+            }
+        }
+
+        // Ball vs Paddle (only bounce if moving downwards)
+        if (bvy > 0 && SweepCircleRect(pos, delta, br, paddleRect, &t, &n) && t < toi &&
+            bvx * n.x + bvy * n.y < 0.0f) {
+            toi = t;
+            normal = n;
+            hitPaddle = true;
+            hitRow = -1;
+        }
+
+        if (hitRow < 0 && !hitPaddle) {
+            pos.x += delta.x;
+            pos.y += delta.y;
+            break;
+        }
+
+        // Advance to the contact point and spend the rest of the tick from there
+        pos.x += delta.x * toi;
+        pos.y += delta.y * toi;
+        timeLeft *= (1.0f - toi);
+        balls.x[i] = pos.x;
+        balls.y[i] = pos.y;
+
+        if (hitPaddle) {
+            BounceOffPaddle(i);
+            pos = balls.GetPosition(i);
+        }
+        else {
+            HitBrick(hitRow, hitCol);
+            // Reflect the velocity about the contact normal (exact for faces, also handles corners)
+            float vn = bvx * normal.x + bvy * normal.y;
+            bvx -= 2.0f * vn * normal.x;
+            bvy -= 2.0f * vn * normal.y;
+            // Step off the surface so the next sweep doesn't start in contact
+            pos.x += normal.x * CONTACT_SKIN;
+            pos.y += normal.y * CONTACT_SKIN;
+        }
+    }
+
+    balls.x[i] = pos.x;
+    balls.y[i] = pos.y;
+}
+
+// Paddle bounce: the exit angle depends on where the ball struck the paddle
+void Simulation::BounceOffPaddle(int i) {
+    float& bx = balls.x[i];
+    float& by = balls.y[i];
+    float& bvx = balls.vx[i];
+    float& bvy = balls.vy[i];
+
+    // Adjust Y position to prevent sinking
+    by = paddle.GetPosition().y - balls.radius[i] - 0.1f;
+
+    float hitPos = bx - (paddle.GetPosition().x + paddle.GetWidth() / 2.0f);
+    float normalizedHitPos = hitPos / (paddle.GetWidth() / 2.0f);
+    normalizedHitPos = fmaxf(-0.95f, fminf(0.95f, normalizedHitPos)); // Clamp influence
+
+    bvx = MAX_BALL_SPEED_X * normalizedHitPos * config.paddleBounceMultiplier;
+
+    // Maintain overall speed (approximately)
+    float speedMagnitude = sqrtf(INITIAL_BALL_SPEED.x * INITIAL_BALL_SPEED.x + INITIAL_BALL_SPEED.y * INITIAL_BALL_SPEED.y);
+    bvy = -sqrtf(fmaxf(1.0f, speedMagnitude * speedMagnitude - bvx * bvx)); // Ensure Y speed is reasonable
+
+    Emit(SIM_EVENT_PADDLE_HIT, Vector2{ bx, by });
+}
+
+// Damage a brick and award score/modifiers if it broke
+void Simulation::HitBrick(int row, int col) {
+    Vector2 brickCenter = bricks.GetBrickCenter(row, col);
+
+    int livesLeft = bricks.Hit(row, col); // Damage the brick
+    Emit(SIM_EVENT_BRICK_HIT, brickCenter, livesLeft);
+
+    if (livesLeft == 0) {
+        score += SCORE_PER_BRICK;
+        if (random.Range(1, 100) <= config.modifierChance) {
+            SpawnModifier(brickCenter);
+        }
+    }
+}
+
+// Spawn a Modifier
+void Simulation::SpawnModifier(Vector2 position) {
+    Modifier newMod;
+    int randType = random.Range(0, 1); // Only two types currently
+    ModifierType type = MOD_NONE;
+    switch (randType) {
+    case 0: type = MOD_MULTIBALL; break;
+    case 1: type = MOD_SCORE_BONUS; break;
+    }
+
+    if (type != MOD_NONE) {
+        newMod.Init(position, type);
+        modifiers.push_back(newMod);
+    }
+}
+
+// Activate Modifier Effect
+void Simulation::ActivateModifier(Modifier& mod) {
+    switch (mod.type) {
+    case MOD_MULTIBALL:
+    {
+        int ballsToSpawn = 4; // Spawn two extra balls
+        Vector2 spawnPos = mod.position; // Spawn near where modifier was collected
+
+        for (int i = 0; i < ballsToSpawn && balls.Count() < config.maxBalls; ++i) { // Limit max balls
+            // Give new ball slightly random upward velocity from paddle
+            // (one draw per statement: evaluation order inside an expression is up to the compiler)
+            float speedScaleX = (float)random.Range(5, 15) / 10.0f;
+            float directionX = (random.Range(0, 1) == 0) ? 1.0f : -1.0f;
+            float speedScaleY = (float)random.Range(8, 12) / 10.0f;
+            Vector2 newSpeed = {
+                 INITIAL_BALL_SPEED.x * speedScaleX * directionX, // Random horizontal component
+                -fabsf(INITIAL_BALL_SPEED.y) * speedScaleY // Random upward vertical
+            };
+
+            balls.Add(spawnPos, newSpeed, BALL_RADIUS, SKYBLUE);
+        }
+    }
+    break;
+    case MOD_SCORE_BONUS:
+        score += 99999;
+        break;
+    case MOD_NONE:
+        break; // Should not happen if SpawnModifier works correctly
+    }
+}
+
+void Simulation::Emit(SimEventType type, Vector2 position, int value) {
+    SimEvent event;
+    event.type = type;
+    event.position = position;
+    event.value = value;
+    events.push_back(event);
+}
+
+// FNV-1a over the raw bytes of the state that affects future ticks
+static uint32_t HashBytes(uint32_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template <typename T>
+static uint32_t HashVector(uint32_t hash, const std::vector<T>& values) {
+    return values.empty() ? hash : HashBytes(hash, values.data(), values.size() * sizeof(T));
+}
+
+uint32_t Simulation::Checksum() const {
+    uint32_t hash = 2166136261u;
+    hash = HashBytes(hash, &score, sizeof(score));
+    hash = HashBytes(hash, &gameTimer, sizeof(gameTimer));
+    hash = HashBytes(hash, &gameOver, sizeof(gameOver));
+
+    Vector2 paddlePosition = paddle.GetPosition();
+    Vector2 paddleSpeed = paddle.GetSpeed();
+    hash = HashBytes(hash, &paddlePosition, sizeof(paddlePosition));
+    hash = HashBytes(hash, &paddleSpeed, sizeof(paddleSpeed));
+
+    hash = HashVector(hash, balls.x);
+    hash = HashVector(hash, balls.y);
+    hash = HashVector(hash, balls.vx);
+    hash = HashVector(hash, balls.vy);
+    hash = HashVector(hash, balls.radius);
+
+    for (int r = 0; r < bricks.GetRows(); ++r) {
+        for (int c = 0; c < bricks.GetCols(); ++c) {
+            unsigned char lives = (unsigned char)bricks.GetLives(r, c);
+            hash = HashBytes(hash, &lives, 1);
+        }
+    }
+
+    for (const Modifier& mod : modifiers) {
+        hash = HashBytes(hash, &mod.position, sizeof(mod.position));
+        hash = HashBytes(hash, &mod.type, sizeof(mod.type));
+        hash = HashBytes(hash, &mod.active, sizeof(mod.active));
+    }
+
+    uint64_t randomState = random.GetState();
+    uint64_t randomIncrement = random.GetIncrement();
+    hash = HashBytes(hash, &randomState, sizeof(randomState));
+    hash = HashBytes(hash, &randomIncrement, sizeof(randomIncrement));
+    return hash;
+}
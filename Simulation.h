@@ -0,0 +1,94 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "raylib.h" // For Vector2, Rectangle, Color (types only, no raylib calls are made)
+#include <vector>
+#include <cstdint>
+#include "Constants.h"
+#include "Paddle.h"
+#include "BallPool.h"
+#include "BrickField.h"
+#include "Modifier.h"
+#include "Random.h"
+
+//------------------------------------------------------------------------------------
+// Headless gameplay core
+// Owns every gameplay object and advances them one fixed tick at a time. It never reads
+// the keyboard, plays audio or draws: input comes in through SimInput and anything the
+// presentation layer should react to (sounds, floating text, flashes) goes out as SimEvents.
+//------------------------------------------------------------------------------------
+
+// Playfield, level layout and balance. DefaultSimConfig() matches the Constants.h values;
+// larger fields (e.g. 1000 x 1000 bricks for stress tests) or balance experiments
+// just need a different config.
+struct SimConfig {
+    float fieldWidth;
+    float fieldHeight;
+    int brickRows;
+    int brickColumns;
+    float brickWidth;
+    float brickHeight;
+    float brickGap;
+    float brickTopOffset;
+    int maxBalls;        // Multiball stops spawning once this many balls are in play
+    float modifierChance;         // Percent chance a destroyed brick drops a modifier
+    float paddleBounceMultiplier; // Scales the sideways speed the paddle edge gives a ball
+    int rowLives[CONFIG_ROW_LIVES]; // Brick lives per row from the top
+};
+
+SimConfig DefaultSimConfig();
+
+// Player input for one tick
+struct SimInput {
+    bool moveLeft;
+    bool moveRight;
+};
+
+// Things that happened during a tick
+typedef enum {
+    SIM_EVENT_PADDLE_HIT,         // position: ball position
+    SIM_EVENT_BRICK_HIT,          // position: brick centre, value: lives left
+    SIM_EVENT_MODIFIER_COLLECTED, // position: modifier position, value: ModifierType
+    SIM_EVENT_LEVEL_CLEARED,      // value: bonus score awarded
+    SIM_EVENT_BALL_LOST,          // position: where the ball left the field
+    SIM_EVENT_GAME_OVER
+} SimEventType;
+
+struct SimEvent {
+    SimEventType type;
+    Vector2 position;
+    int value;
+};
+
+class Simulation {
+public:
+    Paddle paddle;
+    BallPool balls;
+    SimConfig config;
+    BrickField bricks;
+    std::vector<Modifier> modifiers;
+    std::vector<SimEvent> events; // Raised by the last Step(), cleared when the next one starts
+    int score;
+    float gameTimer;
+    bool gameOver;
+    unsigned int seed; // Random seed given to the last Init()
+    Random random;     // Gameplay randomness (modifier drops, multiball), seeded by Init()
+
+    Simulation();
+
+    // Same seed, config and per-tick input always produce the same session
+    void Init(unsigned int randomSeed, const SimConfig& simConfig = DefaultSimConfig());
+    void Step(const SimInput& input, float dt);
+    void ResetBricks();
+    uint32_t Checksum() const; // Hash of the gameplay state, compares replayed sessions
+
+private:
+    void MoveBallSwept(int i, float dt);
+    void BounceOffPaddle(int i);
+    void HitBrick(int row, int col);
+    void SpawnModifier(Vector2 position);
+    void ActivateModifier(Modifier& mod);
+    void Emit(SimEventType type, Vector2 position, int value = 0);
+};
+
+#endif // SIMULATION_H
@@ -0,0 +1,50 @@
+#include "SoundVoicePool.h"
+
+SoundVoicePool::SoundVoicePool() : voices(), startOrder(), playCount(0), voiceCount(0), nextVoice(0) {}
+
+bool SoundVoicePool::Load(const char* fileName, int polyphony) {
+    Unload();
+    if (polyphony < 1) polyphony = 1;
+    if (polyphony > MAX_SOUND_VOICES) polyphony = MAX_SOUND_VOICES;
+
+    voices[0] = LoadSound(fileName);
+    if (voices[0].stream.buffer == nullptr) return false;
+    voiceCount = 1;
+
+    while (voiceCount < polyphony) {
+        Sound alias = LoadSoundAlias(voices[0]);
+        if (alias.stream.buffer == nullptr) break; // Keep the voices we got
+        voices[voiceCount++] = alias;
+    }
+    return true;
+}
+
+void SoundVoicePool::Unload() {
+    // Aliases first, they point into the source's samples
+    for (int i = 1; i < voiceCount; ++i) UnloadSoundAlias(voices[i]);
+    if (voiceCount > 0) UnloadSound(voices[0]);
+    voiceCount = 0;
+    nextVoice = 0;
+    playCount = 0;
+}
+
+void SoundVoicePool::Play() {
+    if (voiceCount == 0) return;
+
+    // First idle voice from the cursor, otherwise the oldest one
+    int voice = -1;
+    int oldest = 0;
+    for (int n = 0; n < voiceCount; ++n) {
+        int i = (nextVoice + n) % voiceCount;
+        if (!IsSoundPlaying(voices[i])) {
+            voice = i;
+            break;
+        }
+        if (playCount - startOrder[i] > playCount - startOrder[oldest]) oldest = i;
+    }
+    if (voice < 0) voice = oldest;
+
+    PlaySound(voices[voice]); // Restarts a stolen voice from the beginning
+    startOrder[voice] = playCount++;
+    nextVoice = (voice + 1) % voiceCount;
+}
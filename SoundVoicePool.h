@@ -0,0 +1,34 @@
+#pragma once
+#ifndef SOUND_VOICE_POOL_H
+#define SOUND_VOICE_POOL_H
+
+#include "raylib.h"
+#include "Constants.h" // For MAX_SOUND_VOICES
+
+//------------------------------------------------------------------------------------
+// Overlapping playback of one sound effect
+// PlaySound() restarts a Sound that is already playing, so rapid hits cut each other off.
+// The pool loads the wav once and adds LoadSoundAlias() voices that share its samples.
+// Play() takes an idle voice, or steals the one started longest ago when all are busy,
+// which also caps how many copies the mixer has to sum.
+//------------------------------------------------------------------------------------
+class SoundVoicePool {
+public:
+    SoundVoicePool();
+
+    bool Load(const char* fileName, int polyphony); // Needs an initialized audio device
+    void Unload();
+    void Play();
+
+    bool IsReady() const { return voiceCount > 0; }
+    int GetPolyphony() const { return voiceCount; }
+
+private:
+    Sound voices[MAX_SOUND_VOICES]; // voices[0] owns the samples, the rest are aliases
+    unsigned int startOrder[MAX_SOUND_VOICES]; // Play() counter value when each voice last started
+    unsigned int playCount;
+    int voiceCount;
+    int nextVoice; // Round-robin cursor for the idle search
+};
+
+#endif // SOUND_VOICE_POOL_H
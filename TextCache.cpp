@@ -0,0 +1,147 @@
+#include "TextCache.h"
+#include "rlgl.h" // For rlSetBlendFactors
+#include <cmath>
+#include <cstring>
+
+static const int TEXT_CACHE_PADDING = 1; // Transparent border so neighbouring runs don't bleed
+
+static unsigned int HashRun(const Font& font, const char* text, float fontSize, float spacing) {
+    // FNV-1a over the string, then the font and layout parameters
+    unsigned int hash = 2166136261u;
+    for (const unsigned char* p = (const unsigned char*)text; *p != '\0'; ++p) {
+        hash = (hash ^ *p) * 16777619u;
+    }
+    unsigned int sizeBits, spacingBits;
+    memcpy(&sizeBits, &fontSize, sizeof(sizeBits));
+    memcpy(&spacingBits, &spacing, sizeof(spacingBits));
+    hash = (hash ^ font.texture.id) * 16777619u;
+    hash = (hash ^ sizeBits) * 16777619u;
+    hash = (hash ^ spacingBits) * 16777619u;
+    return hash;
+}
+
+TextCache::TextCache() : entries(), entryCount(0), atlas(), shelfX(0), shelfY(0), shelfHeight(0) {}
+
+TextCache::Entry* TextCache::Find(const Font& font, const char* text, float fontSize, float spacing) {
+    if (strlen(text) >= (size_t)TEXT_CACHE_MAX_LENGTH) return nullptr;
+
+    const unsigned int hash = HashRun(font, text, fontSize, spacing);
+    const unsigned int mask = TEXT_CACHE_CAPACITY - 1;
+    for (unsigned int i = hash & mask;; i = (i + 1) & mask) {
+        Entry& entry = entries[i];
+        if (!entry.used) {
+            // Keep the table at most half full so probe chains stay short
+            if (entryCount >= TEXT_CACHE_CAPACITY / 2) {
+                Clear();
+                return Find(font, text, fontSize, spacing);
+            }
+            entry.used = true;
+            entry.rasterized = false;
+            entry.hash = hash;
+            entry.fontId = font.texture.id;
+            entry.glyphs = font.glyphs;
+            entry.fontSize = fontSize;
+            entry.spacing = spacing;
+            entry.size = MeasureTextEx(font, text, fontSize, spacing);
+            strcpy(entry.text, text);
+            entryCount++;
+            return &entry;
+        }
+        if (entry.hash == hash && entry.fontId == font.texture.id && entry.glyphs == font.glyphs &&
+            entry.fontSize == fontSize && entry.spacing == spacing && strcmp(entry.text, text) == 0) {
+            return &entry;
+        }
+    }
+}
+
+bool TextCache::AllocateRegion(int width, int height, Rectangle* region) {
+    if (width > TEXT_CACHE_ATLAS_SIZE || height > TEXT_CACHE_ATLAS_SIZE) return false;
+    if (shelfX + width > TEXT_CACHE_ATLAS_SIZE) {
+        // Start a new shelf under the tallest run of the current one
+        shelfY += shelfHeight;
+        shelfX = 0;
+        shelfHeight = 0;
+    }
+    if (shelfY + height > TEXT_CACHE_ATLAS_SIZE) return false;
+
+    *region = { (float)shelfX, (float)shelfY, (float)width, (float)height };
+    shelfX += width;
+    if (height > shelfHeight) shelfHeight = height;
+    return true;
+}
+
+bool TextCache::Rasterize(Entry* entry, const Font& font) {
+    if (atlas.id == 0) {
+        atlas = LoadRenderTexture(TEXT_CACHE_ATLAS_SIZE, TEXT_CACHE_ATLAS_SIZE);
+        if (atlas.id == 0) return false;
+        BeginTextureMode(atlas);
+        ClearBackground(BLANK);
+        EndTextureMode();
+    }
+
+    const int width = (int)ceilf(entry->size.x) + 2 * TEXT_CACHE_PADDING;
+    const int height = (int)ceilf(entry->size.y) + 2 * TEXT_CACHE_PADDING;
+    Rectangle region;
+    if (!AllocateRegion(width, height, &region)) return false;
+
+    // Glyphs go in white so the tint reproduces DrawTextEx's colour. Plain alpha blending
+    // would square the coverage on the transparent atlas, so composite with (ONE, ONE_MINUS_SRC_ALPHA).
+    BeginTextureMode(atlas);
+    rlSetBlendFactors(RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM);
+    DrawTextEx(font, entry->text, { region.x + TEXT_CACHE_PADDING, region.y + TEXT_CACHE_PADDING }, entry->fontSize, entry->spacing, WHITE);
+    EndBlendMode();
+    EndTextureMode();
+
+    entry->region = region;
+    entry->rasterized = true;
+    return true;
+}
+
+Vector2 TextCache::Measure(Font font, const char* text, float fontSize, float spacing) {
+    Entry* entry = Find(font, text, fontSize, spacing);
+    if (entry == nullptr) return MeasureTextEx(font, text, fontSize, spacing);
+    return entry->size;
+}
+
+void TextCache::Draw(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color tint) {
+    Entry* entry = Find(font, text, fontSize, spacing);
+    if (entry != nullptr && !entry->rasterized && !Rasterize(entry, font)) {
+        // Atlas full: start over once, a run that still doesn't fit is drawn directly
+        Clear();
+        entry = Find(font, text, fontSize, spacing);
+        if (!Rasterize(entry, font)) entry = nullptr;
+    }
+    if (entry == nullptr) {
+        DrawTextEx(font, text, position, fontSize, spacing, tint);
+        return;
+    }
+
+    // Render textures are stored bottom-up, so flip the region
+    const Rectangle& region = entry->region;
+    Rectangle source = { region.x, TEXT_CACHE_ATLAS_SIZE - region.y - region.height, region.width, -region.height };
+    DrawTextureRec(atlas.texture, source, { position.x - TEXT_CACHE_PADDING, position.y - TEXT_CACHE_PADDING }, tint);
+}
+
+void TextCache::Clear() {
+    for (Entry& entry : entries) entry.used = false;
+    entryCount = 0;
+    shelfX = 0;
+    shelfY = 0;
+    shelfHeight = 0;
+    if (atlas.id != 0) {
+        BeginTextureMode(atlas);
+        ClearBackground(BLANK);
+        EndTextureMode();
+    }
+}
+
+void TextCache::Unload() {
+    if (atlas.id != 0) UnloadRenderTexture(atlas);
+    atlas = RenderTexture2D();
+    for (Entry& entry : entries) entry.used = false;
+    entryCount = 0;
+    shelfX = 0;
+    shelfY = 0;
+    shelfHeight = 0;
+}
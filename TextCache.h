@@ -0,0 +1,52 @@
+#pragma once
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "raylib.h"
+#include "Constants.h" // For TEXT_CACHE_* sizes
+
+//------------------------------------------------------------------------------------
+// Rasterized text runs
+// A (font, string, size, spacing) run is laid out and drawn once, white, into a shared
+// atlas texture (shelf packed), after that drawing it is a single tinted quad. Measurements
+// are memoized in the same table. When the table or the atlas fills up the whole cache is
+// dropped and refilled, which is cheap next to laying glyphs out every frame.
+// Strings longer than TEXT_CACHE_MAX_LENGTH go straight to MeasureTextEx/DrawTextEx.
+//------------------------------------------------------------------------------------
+class TextCache {
+public:
+    TextCache();
+
+    Vector2 Measure(Font font, const char* text, float fontSize, float spacing);
+    void Draw(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color tint);
+    void Clear();
+    void Unload();
+
+    int GetEntryCount() const { return entryCount; }
+
+private:
+    struct Entry {
+        bool used;
+        bool rasterized;
+        unsigned int hash;
+        unsigned int fontId;      // Font texture, together with glyphs identifies the font
+        const GlyphInfo* glyphs;
+        float fontSize;
+        float spacing;
+        Vector2 size;             // MeasureTextEx result
+        Rectangle region;         // Atlas area (padding included), valid once rasterized
+        char text[TEXT_CACHE_MAX_LENGTH];
+    };
+
+    Entry* Find(const Font& font, const char* text, float fontSize, float spacing);
+    bool Rasterize(Entry* entry, const Font& font);
+    bool AllocateRegion(int width, int height, Rectangle* region);
+
+    Entry entries[TEXT_CACHE_CAPACITY]; // Open addressing, linear probing
+    int entryCount;
+
+    RenderTexture2D atlas;
+    int shelfX, shelfY, shelfHeight;
+};
+
+#endif // TEXT_CACHE_H
@@ -0,0 +1,96 @@
+#include "ThreadPool.h"
+
+// Worker the calling thread belongs to, so tasks that submit more work keep it local
+static thread_local const ThreadPool* currentPool = nullptr;
+static thread_local int currentWorker = -1;
+
+ThreadPool::ThreadPool(int threadCount) : queuedTasks(0), pendingTasks(0), nextQueue(0), stopping(false) {
+    if (threadCount <= 0) threadCount = (int)std::thread::hardware_concurrency();
+    if (threadCount <= 0) threadCount = 1;
+
+    for (int i = 0; i < threadCount; ++i) {
+        queues.emplace_back(new WorkerQueue());
+    }
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    Wait();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    int index = (currentPool == this) ? currentWorker : (int)(nextQueue++ % queues.size());
+
+    pendingTasks++;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // Counted under stateMutex so a worker can't miss it between its check and its wait
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queuedTasks++;
+    }
+    workReady.notify_one();
+}
+
+void ThreadPool::Wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pendingTasks.load() == 0; });
+}
+
+bool ThreadPool::TryPop(int index, std::function<void()>& task) {
+    WorkerQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool ThreadPool::TrySteal(int thief, std::function<void()>& task) {
+    const int count = (int)queues.size();
+    for (int offset = 1; offset < count; ++offset) {
+        WorkerQueue& queue = *queues[(thief + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(int index) {
+    currentPool = this;
+    currentWorker = index;
+
+    std::function<void()> task;
+    for (;;) {
+        if (TryPop(index, task) || TrySteal(index, task)) {
+            queuedTasks--;
+            task();
+            task = nullptr; // Release captures before reporting completion
+
+            if (--pendingTasks == 0) {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                allDone.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workReady.wait(lock, [this] { return stopping || queuedTasks.load() > 0; });
+        if (stopping && queuedTasks.load() == 0) return;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------------
+// Work-stealing thread pool
+// Each worker owns a task deque. It pops from the back of its own (newest first, still
+// warm in cache) and, once that is empty, steals from the front of the others (oldest
+// first, usually the biggest chunk of remaining work). Tasks submitted from outside are
+// dealt round-robin; tasks submitted by a task go to that worker's own deque.
+// Deques are guarded by their own small mutex, contention only happens while stealing.
+//------------------------------------------------------------------------------------
+class ThreadPool {
+public:
+    explicit ThreadPool(int threadCount = 0); // 0: one worker per hardware thread
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> task);
+    void Wait(); // Blocks until every submitted task has finished
+
+    int GetThreadCount() const { return (int)workers.size(); }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void WorkerLoop(int index);
+    bool TryPop(int index, std::function<void()>& task);
+    bool TrySteal(int thief, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex stateMutex;             // Guards sleeping/waking, not the queues
+    std::condition_variable workReady; // A task was queued, or the pool is stopping
+    std::condition_variable allDone;   // pendingTasks reached zero
+    std::atomic<int> queuedTasks;      // Submitted, not yet taken by a worker
+    std::atomic<int> pendingTasks;     // Submitted, not yet finished
+    std::atomic<unsigned int> nextQueue;
+    bool stopping;
+};
+
+#endif // THREAD_POOL_H
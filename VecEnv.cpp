@@ -0,0 +1,140 @@
+#include "VecEnv.h"
+#include <algorithm> // For std::min, std::swap
+
+VecEnvConfig DefaultVecEnvConfig() {
+    VecEnvConfig config;
+    config.sim = DefaultSimConfig();
+    config.envCount = 64;
+    config.seed = 1;
+    config.ticksPerStep = 4;
+    config.maxEpisodeTime = 600.0f;
+    config.threads = 0;
+    return config;
+}
+
+VecEnv::VecEnv(const VecEnvConfig& envConfig) : config(envConfig) {
+    if (config.envCount < 1) config.envCount = 1;
+    if (config.ticksPerStep < 1) config.ticksPerStep = 1;
+
+    envs.resize(config.envCount);
+    for (int i = 0; i < config.envCount; ++i) {
+        envs[i].episodeSeeds.Seed(config.seed, (uint64_t)i);
+    }
+
+    if (config.threads > 1) pool.reset(new ThreadPool(config.threads));
+}
+
+int VecEnv::GetObservationSize() const {
+    return 2 + VEC_ENV_OBSERVED_BALLS * 5 + 3 + 1;
+}
+
+void VecEnv::ResetEnv(int env) {
+    Env& e = envs[env];
+    e.simulation.Init(e.episodeSeeds.NextU32(), config.sim);
+}
+
+void VecEnv::Reset(float* observations) {
+    const int size = GetObservationSize();
+    for (int i = 0; i < (int)envs.size(); ++i) {
+        ResetEnv(i);
+        WriteObservation(i, observations + (size_t)i * size);
+    }
+}
+
+void VecEnv::Step(const int* actions, float* observations, float* rewards, unsigned char* dones) {
+    const int count = (int)envs.size();
+    if (!pool) {
+        StepRange(0, count, actions, observations, rewards, dones);
+        return;
+    }
+
+    // A few chunks per worker so stealing can even out envs that hit a reset
+    const int chunks = pool->GetThreadCount() * 4;
+    const int chunkSize = std::max(1, (count + chunks - 1) / chunks);
+    for (int first = 0; first < count; first += chunkSize) {
+        int last = std::min(first + chunkSize, count);
+        pool->Submit([=] { StepRange(first, last, actions, observations, rewards, dones); });
+    }
+    pool->Wait();
+}
+
+void VecEnv::StepRange(int first, int last, const int* actions, float* observations, float* rewards, unsigned char* dones) {
+    const int size = GetObservationSize();
+
+    for (int i = first; i < last; ++i) {
+        Simulation& simulation = envs[i].simulation;
+
+        SimInput input;
+        input.moveLeft = actions[i] == VEC_ENV_ACTION_LEFT;
+        input.moveRight = actions[i] == VEC_ENV_ACTION_RIGHT;
+
+        float reward = 0.0f;
+        for (int tick = 0; tick < config.ticksPerStep && !simulation.gameOver; ++tick) {
+            simulation.Step(input, SIM_DT);
+            for (const SimEvent& event : simulation.events) {
+                if (event.type == SIM_EVENT_BRICK_HIT && event.value == 0) reward += 1.0f;
+                else if (event.type == SIM_EVENT_PADDLE_HIT) reward += VEC_ENV_PADDLE_HIT_REWARD;
+                else if (event.type == SIM_EVENT_BALL_LOST) reward -= 1.0f;
+            }
+        }
+
+        unsigned char done = VEC_ENV_DONE_NONE;
+        if (simulation.gameOver) done = VEC_ENV_DONE_GAME_OVER;
+        else if (config.maxEpisodeTime > 0.0f && simulation.gameTimer >= config.maxEpisodeTime) done = VEC_ENV_DONE_TIME_LIMIT;
+
+        if (done != VEC_ENV_DONE_NONE) ResetEnv(i);
+
+        rewards[i] = reward;
+        dones[i] = done;
+        WriteObservation(i, observations + (size_t)i * size);
+    }
+}
+
+void VecEnv::WriteObservation(int env, float* out) const {
+    const Simulation& simulation = envs[env].simulation;
+    const float invWidth = 1.0f / simulation.config.fieldWidth;
+    const float invHeight = 1.0f / simulation.config.fieldHeight;
+    const float invSpeed = 1.0f / VEC_ENV_SPEED_SCALE;
+
+    *out++ = (simulation.paddle.GetPosition().x + simulation.paddle.GetWidth() / 2.0f) * invWidth;
+    *out++ = simulation.paddle.GetSpeed().x * invSpeed;
+
+    // Lowest balls first: those are the ones about to be lost
+    int picked[VEC_ENV_OBSERVED_BALLS];
+    int pickedCount = 0;
+    const BallPool& balls = simulation.balls;
+    for (int i = 0; i < balls.Count(); ++i) {
+        if (pickedCount < VEC_ENV_OBSERVED_BALLS) picked[pickedCount++] = i;
+        else if (balls.y[i] > balls.y[picked[pickedCount - 1]]) picked[pickedCount - 1] = i;
+        else continue;
+
+        // Insertion sort step, keeps picked ordered by descending y
+        for (int k = pickedCount - 1; k > 0 && balls.y[picked[k]] > balls.y[picked[k - 1]]; --k) {
+            std::swap(picked[k], picked[k - 1]);
+        }
+    }
+    for (int k = 0; k < VEC_ENV_OBSERVED_BALLS; ++k) {
+        if (k < pickedCount) {
+            int i = picked[k];
+            *out++ = 1.0f;
+            *out++ = balls.x[i] * invWidth;
+            *out++ = balls.y[i] * invHeight;
+            *out++ = balls.vx[i] * invSpeed;
+            *out++ = balls.vy[i] * invSpeed;
+        }
+        else {
+            for (int f = 0; f < 5; ++f) *out++ = 0.0f;
+        }
+    }
+
+    const Modifier* lowestModifier = nullptr;
+    for (const Modifier& mod : simulation.modifiers) {
+        if (mod.active && (lowestModifier == nullptr || mod.position.y > lowestModifier->position.y)) lowestModifier = &mod;
+    }
+    *out++ = lowestModifier ? 1.0f : 0.0f;
+    *out++ = lowestModifier ? lowestModifier->position.x * invWidth : 0.0f;
+    *out++ = lowestModifier ? lowestModifier->position.y * invHeight : 0.0f;
+
+    int brickCount = simulation.config.brickRows * simulation.config.brickColumns;
+    *out++ = brickCount > 0 ? (float)simulation.bricks.GetLiveCount() / brickCount : 0.0f;
+}
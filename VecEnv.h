@@ -0,0 +1,84 @@
+#pragma once
+#ifndef VEC_ENV_H
+#define VEC_ENV_H
+
+#include <memory>
+#include <vector>
+#include "Simulation.h"
+#include "Random.h"
+#include "ThreadPool.h"
+
+//------------------------------------------------------------------------------------
+// Vectorized environment for training paddle agents
+// K simulations stepped in lockstep, no window or rendering. Every call works on flat
+// caller-owned buffers so bindings can pass numpy arrays straight through:
+//   observations  K * GetObservationSize() floats, env-major
+//   actions       K ints: VEC_ENV_ACTION_STAY / LEFT / RIGHT
+//   rewards       K floats
+//   dones         K bytes: 0 running, VEC_ENV_DONE_GAME_OVER, VEC_ENV_DONE_TIME_LIMIT
+// An env that finishes is reset on the spot with a fresh seed; its observation is
+// already the first one of the new episode (the usual vector-env auto-reset).
+//
+// Observation of one env, positions scaled to [0, 1] by the field size, speeds by
+// VEC_ENV_SPEED_SCALE:
+//   paddle centre x, paddle speed x,
+//   VEC_ENV_OBSERVED_BALLS x (present, x, y, vx, vy), lowest balls first,
+//   lowest modifier (present, x, y), fraction of bricks still alive
+// Reward per step: bricks destroyed + VEC_ENV_PADDLE_HIT_REWARD per paddle hit
+// - 1 per ball lost.
+//------------------------------------------------------------------------------------
+enum VecEnvAction {
+    VEC_ENV_ACTION_STAY = 0,
+    VEC_ENV_ACTION_LEFT = 1,
+    VEC_ENV_ACTION_RIGHT = 2
+};
+
+enum VecEnvDone {
+    VEC_ENV_DONE_NONE = 0,
+    VEC_ENV_DONE_GAME_OVER = 1,
+    VEC_ENV_DONE_TIME_LIMIT = 2
+};
+
+const int VEC_ENV_OBSERVED_BALLS = 3;
+const float VEC_ENV_SPEED_SCALE = 1000.0f;
+const float VEC_ENV_PADDLE_HIT_REWARD = 0.1f;
+
+struct VecEnvConfig {
+    SimConfig sim;
+    int envCount;
+    unsigned int seed;     // Seeds every env's episode stream
+    int ticksPerStep;      // Simulation ticks per Step() with the action held (frame skip)
+    float maxEpisodeTime;  // Game seconds before an episode is cut off, 0 for no limit
+    int threads;           // 0 or 1: step on the calling thread, otherwise a pool of this size
+};
+
+VecEnvConfig DefaultVecEnvConfig();
+
+class VecEnv {
+public:
+    explicit VecEnv(const VecEnvConfig& envConfig);
+
+    int GetEnvCount() const { return (int)envs.size(); }
+    int GetObservationSize() const;
+
+    void Reset(float* observations);
+    void Step(const int* actions, float* observations, float* rewards, unsigned char* dones);
+
+    const Simulation& GetSimulation(int env) const { return envs[env].simulation; }
+
+private:
+    struct Env {
+        Simulation simulation;
+        Random episodeSeeds; // Seed of each new episode
+    };
+
+    void ResetEnv(int env);
+    void StepRange(int first, int last, const int* actions, float* observations, float* rewards, unsigned char* dones);
+    void WriteObservation(int env, float* out) const;
+
+    VecEnvConfig config;
+    std::vector<Env> envs;
+    std::unique_ptr<ThreadPool> pool;
+};
+
+#endif // VEC_ENV_H
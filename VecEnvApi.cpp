@@ -0,0 +1,45 @@
+#include "VecEnvApi.h"
+#include "VecEnv.h"
+#include <new> // For std::nothrow
+
+struct BrickVecEnv {
+    VecEnv env;
+    explicit BrickVecEnv(const VecEnvConfig& config) : env(config) {}
+};
+
+BrickVecEnv *LoadBrickVecEnv(int envCount, unsigned int seed, int ticksPerStep, float maxEpisodeTime, int threads) {
+    VecEnvConfig config = DefaultVecEnvConfig();
+    config.envCount = envCount;
+    config.seed = seed;
+    config.ticksPerStep = ticksPerStep;
+    config.maxEpisodeTime = maxEpisodeTime;
+    config.threads = threads;
+
+    // No exceptions across the C boundary
+    try {
+        return new (std::nothrow) BrickVecEnv(config);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void UnloadBrickVecEnv(BrickVecEnv *env) {
+    delete env;
+}
+
+int GetBrickVecEnvCount(const BrickVecEnv *env) {
+    return env->env.GetEnvCount();
+}
+
+int GetBrickVecEnvObservationSize(const BrickVecEnv *env) {
+    return env->env.GetObservationSize();
+}
+
+void ResetBrickVecEnv(BrickVecEnv *env, float *observations) {
+    env->env.Reset(observations);
+}
+
+void StepBrickVecEnv(BrickVecEnv *env, const int *actions, float *observations, float *rewards, unsigned char *dones) {
+    env->env.Step(actions, observations, rewards, dones);
+}
@@ -0,0 +1,45 @@
+/**********************************************************************************************
+*
+*   VecEnvApi - C interface to VecEnv for language bindings (see python/brickbreaker_env.py)
+*
+*   Built into the brickbreaker_env shared library. Buffers are caller-owned and flat, sizes
+*   follow VecEnv.h: observations envCount*GetBrickVecEnvObservationSize() floats, actions
+*   envCount ints (0 stay, 1 left, 2 right), rewards envCount floats, dones envCount bytes
+*   (0 running, 1 game over, 2 time limit; the env has already been reset when non-zero).
+*
+**********************************************************************************************/
+
+#ifndef VEC_ENV_API_H
+#define VEC_ENV_API_H
+
+#if defined(_WIN32)
+    #if defined(BUILD_VEC_ENV_API)
+        #define VECENVAPI __declspec(dllexport)
+    #else
+        #define VECENVAPI __declspec(dllimport)
+    #endif
+#else
+    #define VECENVAPI __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BrickVecEnv BrickVecEnv;
+
+// threads: 0 or 1 steps on the calling thread; maxEpisodeTime: game seconds, 0 for no limit
+VECENVAPI BrickVecEnv *LoadBrickVecEnv(int envCount, unsigned int seed, int ticksPerStep, float maxEpisodeTime, int threads);
+VECENVAPI void UnloadBrickVecEnv(BrickVecEnv *env);
+
+VECENVAPI int GetBrickVecEnvCount(const BrickVecEnv *env);
+VECENVAPI int GetBrickVecEnvObservationSize(const BrickVecEnv *env);
+
+VECENVAPI void ResetBrickVecEnv(BrickVecEnv *env, float *observations);
+VECENVAPI void StepBrickVecEnv(BrickVecEnv *env, const int *actions, float *observations, float *rewards, unsigned char *dones);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VEC_ENV_API_H
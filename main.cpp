@@ -1,15 +1,16 @@
 #include "raylib.h"
 #include "Constants.h" 
 #include "GameState.h" 
-#include <cstdlib>    // For srand
-#include <ctime>      
+#include "Profiler.h"
+#include "FrameTrace.h"
 
 int main() {
     // Initialization
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Advanced Brick Breaker - Gregory.Dearham@LinkedIN ");
+    SetTraceEventCallback(TraceSection); // Buffer swap, frame wait and audio mixing show up in frame traces
     InitAudioDevice();
     SetTargetFPS(144);
-    srand(time(NULL)); // Seed random number generator once
+    SetProfilerThread(); // Only the main loop records profile zones
 
     // Load global resources (font, sounds) using the function from GameState.cpp
     LoadGameResources();
@@ -0,0 +1,105 @@
+"""Vectorized Brick Breaker environments for training paddle agents.
+
+Thin ctypes wrapper over the brickbreaker_env shared library (VecEnvApi.h). Build it with
+CMake (target brickbreaker_env) and point BRICKBREAKER_ENV_LIB at the library, or leave
+it next to this file.
+
+    env = VecEnv(num_envs=256, threads=8)
+    obs = env.reset()                      # (num_envs, obs_size) float32
+    obs, rewards, dones = env.step(actions)  # actions: (num_envs,) ints, 0 stay 1 left 2 right
+
+dones is 1 on game over and 2 on the time limit; that env has already been reset and its
+row of obs is the first observation of the new episode. Arrays returned by reset/step are
+reused by the next call, copy them if you keep them around.
+"""
+
+import ctypes
+import os
+import sys
+
+import numpy as np
+
+ACTION_STAY = 0
+ACTION_LEFT = 1
+ACTION_RIGHT = 2
+
+DONE_GAME_OVER = 1
+DONE_TIME_LIMIT = 2
+
+
+def _library_path():
+    path = os.environ.get("BRICKBREAKER_ENV_LIB")
+    if path:
+        return path
+    if sys.platform == "win32":
+        name = "brickbreaker_env.dll"
+    elif sys.platform == "darwin":
+        name = "libbrickbreaker_env.dylib"
+    else:
+        name = "libbrickbreaker_env.so"
+    return os.path.join(os.path.dirname(os.path.abspath(__file__)), name)
+
+
+_lib = ctypes.CDLL(_library_path())
+
+_float_p = ctypes.POINTER(ctypes.c_float)
+_int_p = ctypes.POINTER(ctypes.c_int)
+_ubyte_p = ctypes.POINTER(ctypes.c_ubyte)
+
+_lib.LoadBrickVecEnv.argtypes = [ctypes.c_int, ctypes.c_uint, ctypes.c_int, ctypes.c_float, ctypes.c_int]
+_lib.LoadBrickVecEnv.restype = ctypes.c_void_p
+_lib.UnloadBrickVecEnv.argtypes = [ctypes.c_void_p]
+_lib.UnloadBrickVecEnv.restype = None
+_lib.GetBrickVecEnvCount.argtypes = [ctypes.c_void_p]
+_lib.GetBrickVecEnvCount.restype = ctypes.c_int
+_lib.GetBrickVecEnvObservationSize.argtypes = [ctypes.c_void_p]
+_lib.GetBrickVecEnvObservationSize.restype = ctypes.c_int
+_lib.ResetBrickVecEnv.argtypes = [ctypes.c_void_p, _float_p]
+_lib.ResetBrickVecEnv.restype = None
+_lib.StepBrickVecEnv.argtypes = [ctypes.c_void_p, _int_p, _float_p, _float_p, _ubyte_p]
+_lib.StepBrickVecEnv.restype = None
+
+
+class VecEnv:
+    def __init__(self, num_envs, seed=1, ticks_per_step=4, max_episode_time=600.0, threads=0):
+        self._handle = None  # close() runs from __del__ even when construction fails
+        self._handle = _lib.LoadBrickVecEnv(num_envs, seed, ticks_per_step, max_episode_time, threads)
+        if not self._handle:
+            raise MemoryError("LoadBrickVecEnv failed")
+
+        self.num_envs = _lib.GetBrickVecEnvCount(self._handle)
+        self.observation_size = _lib.GetBrickVecEnvObservationSize(self._handle)
+
+        self._obs = np.zeros((self.num_envs, self.observation_size), dtype=np.float32)
+        self._rewards = np.zeros(self.num_envs, dtype=np.float32)
+        self._dones = np.zeros(self.num_envs, dtype=np.uint8)
+        self._actions = np.zeros(self.num_envs, dtype=np.int32)
+
+    def reset(self):
+        _lib.ResetBrickVecEnv(self._handle, self._obs.ctypes.data_as(_float_p))
+        return self._obs
+
+    def step(self, actions):
+        np.copyto(self._actions, actions, casting="unsafe")
+        _lib.StepBrickVecEnv(
+            self._handle,
+            self._actions.ctypes.data_as(_int_p),
+            self._obs.ctypes.data_as(_float_p),
+            self._rewards.ctypes.data_as(_float_p),
+            self._dones.ctypes.data_as(_ubyte_p),
+        )
+        return self._obs, self._rewards, self._dones
+
+    def close(self):
+        if self._handle:
+            _lib.UnloadBrickVecEnv(self._handle)
+            self._handle = None
+
+    def __del__(self):
+        self.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
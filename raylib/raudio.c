@@ -184,6 +184,10 @@ typedef struct tagBITMAPINFOHEADER {
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
     #endif
+    #ifndef TRACE_EVENT_BEGIN
+        #define TRACE_EVENT_BEGIN(name) (void)0
+        #define TRACE_EVENT_END(name)   (void)0
+    #endif
 
     // Allow custom memory allocators
     #ifndef RL_MALLOC
@@ -278,6 +282,30 @@ typedef struct tagBITMAPINFOHEADER {
     #include "external/jar_mod.h"       // MOD loading functions
 #endif
 
+// SIMD mixing kernels, selected at InitAudioDevice() from the CPU features
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RAUDIO_MIX_SSE2
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics [Used in MixSamplesSSE2()]
+
+    #if defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__)
+        #define RAUDIO_MIX_AVX
+        #include <immintrin.h>          // Required for: AVX intrinsics [Used in MixSamplesAVX()]
+        #if defined(_MSC_VER)
+            #include <intrin.h>         // Required for: __cpuid(), _xgetbv() [Used in IsCpuAVXSupported()]
+        #endif
+    #endif
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define RAUDIO_MIX_NEON
+    #include <arm_neon.h>               // Required for: NEON intrinsics [Used in MixSamplesNEON()]
+#endif
+
+#if defined(RAUDIO_MIX_AVX) && (defined(__GNUC__) || defined(__clang__))
+    #define RAUDIO_TARGET_AVX __attribute__((target("avx")))   // Compiled for AVX even without -mavx, only called after the CPU check
+#else
+    #define RAUDIO_TARGET_AVX
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -294,6 +322,9 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Audio buffer commands in flight to the mixer, must be a power of two
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -334,6 +365,18 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Audio buffer command type, queued by the game thread and run by the mixer
+// NOTE: State commands (PLAY to RESUME) must stay first, they are counted per buffer
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,
+    AUDIO_COMMAND_STOP,
+    AUDIO_COMMAND_PAUSE,
+    AUDIO_COMMAND_RESUME,
+    AUDIO_COMMAND_VOLUME,
+    AUDIO_COMMAND_PITCH,
+    AUDIO_COMMAND_PAN
+} AudioCommandType;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -357,6 +400,10 @@ struct rAudioBuffer {
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
+    ma_uint32 pendingStateCommands; // Play/stop/pause/resume commands not yet run by the mixer (atomic)
+    bool queuedPlaying;             // Playing state once pending commands run (game thread only)
+    bool queuedPaused;              // Paused state once pending commands run (game thread only)
+
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
 };
@@ -371,6 +418,13 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio buffer command
+typedef struct AudioCommand {
+    AudioBuffer *buffer;            // Target audio buffer
+    int type;                       // Command type: AudioCommandType
+    float value;                    // Volume, pitch or pan value
+} AudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
@@ -386,6 +440,11 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE];   // Single-producer/single-consumer ring
+        ma_uint32 head;             // Next slot to write, only stored by the game thread (atomic)
+        ma_uint32 tail;             // Next slot to read, only stored by the lock holder (atomic)
+    } Command;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -409,6 +468,28 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
 
+static void PushAudioCommand(AudioBuffer *buffer, int type, float value);   // Queue a command for the mixer
+static void ExecuteAudioCommand(AudioCommand command);                      // Run a command on mixer state owned by the caller
+static void DrainAudioCommands(void);                                       // Run all queued commands, AUDIO.System.lock must be held
+static void ResetAudioBuffer(AudioBuffer *buffer);                          // Stop an audio buffer immediately (mixer side)
+
+// Mixing kernels: out[i] += in[i]*gain, gainEven on even samples and gainOdd on odd ones (interleaved stereo L/R)
+typedef void (*MixSamplesFunc)(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+static void MixSamplesScalar(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+#if defined(RAUDIO_MIX_SSE2)
+static void MixSamplesSSE2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+#endif
+#if defined(RAUDIO_MIX_AVX)
+static void MixSamplesAVX(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+static bool IsCpuAVXSupported(void);
+#endif
+#if defined(RAUDIO_MIX_NEON)
+static void MixSamplesNEON(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+#endif
+static MixSamplesFunc SelectMixSamplesKernel(const char **name);    // Best kernel for this CPU
+
+static MixSamplesFunc mixSamples = MixSamplesScalar;    // Kernel used by MixAudioFrames()
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -495,8 +576,12 @@ void InitAudioDevice(void)
         return;
     }
 
+    const char *mixKernelName = NULL;
+    mixSamples = SelectMixSamplesKernel(&mixKernelName);
+
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio / %s", ma_get_backend_name(AUDIO.System.context.backend));
+    TRACELOG(LOG_INFO, "    > Mixing:        %s", mixKernelName);
     TRACELOG(LOG_INFO, "    > Format:        %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
     TRACELOG(LOG_INFO, "    > Channels:      %d -> %d", AUDIO.System.device.playback.channels, AUDIO.System.device.playback.internalChannels);
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
@@ -510,11 +595,19 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
+
+        // The mixer is stopped: run what is still queued so no buffer keeps pending state commands
+        ma_mutex_lock(&AUDIO.System.lock);
+        DrainAudioCommands();
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        ma_mutex_uninit(&AUDIO.System.lock);
         ma_context_uninit(&AUDIO.System.context);
 
         AUDIO.System.isReady = false;
+        AUDIO.Command.head = 0;
+        AUDIO.Command.tail = 0;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -598,19 +691,24 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_data_converter_uninit(&buffer->converter, NULL);
         UntrackAudioBuffer(buffer);
+        ma_data_converter_uninit(&buffer->converter, NULL);
         RL_FREE(buffer->data);
         RL_FREE(buffer);
     }
 }
 
 // Check if an audio buffer is playing
+// NOTE: Commands still in the queue are taken into account, so the result matches the last call made
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    if (buffer != NULL)
+    {
+        if (c89atomic_load_explicit_32(&buffer->pendingStateCommands, c89atomic_memory_order_acquire) > 0) result = (buffer->queuedPlaying && !buffer->queuedPaused);
+        else result = (buffer->playing && !buffer->paused);
+    }
 
     return result;
 }
@@ -620,63 +718,37 @@ bool IsAudioBufferPlaying(AudioBuffer *buffer)
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained.
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-    }
+    if (buffer != NULL) PushAudioCommand(buffer, AUDIO_COMMAND_PLAY, 0.0f);
 }
 
 // Stop an audio buffer
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        if (IsAudioBufferPlaying(buffer))
-        {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
-        }
-    }
+    if (buffer != NULL) PushAudioCommand(buffer, AUDIO_COMMAND_STOP, 0.0f);
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = true;
+    if (buffer != NULL) PushAudioCommand(buffer, AUDIO_COMMAND_PAUSE, 0.0f);
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = false;
+    if (buffer != NULL) PushAudioCommand(buffer, AUDIO_COMMAND_RESUME, 0.0f);
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL) buffer->volume = volume;
+    if (buffer != NULL) PushAudioCommand(buffer, AUDIO_COMMAND_VOLUME, volume);
 }
 
 // Set pitch for an audio buffer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        // Pitching is just an adjustment of the sample rate.
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-    }
+    if ((buffer != NULL) && (pitch > 0.0f)) PushAudioCommand(buffer, AUDIO_COMMAND_PITCH, pitch);
 }
 
 // Set pan for an audio buffer
@@ -685,7 +757,7 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < 0.0f) pan = 0.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL) buffer->pan = pan;
+    if (buffer != NULL) PushAudioCommand(buffer, AUDIO_COMMAND_PAN, pan);
 }
 
 // Track audio buffer to linked list next position
@@ -710,6 +782,9 @@ void UntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
     {
+        // Commands still queued for this buffer must run before its memory is released
+        DrainAudioCommands();
+
         if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
         else buffer->prev->next = buffer->next;
 
@@ -926,14 +1001,17 @@ Sound LoadSoundAlias(Sound source)
 {
     Sound sound = { 0 };
 
-    if (source.stream.buffer->data != NULL)
+    if ((source.stream.buffer != NULL) && (source.stream.buffer->data != NULL))
     {
-        AudioBuffer* audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, source.frameCount, AUDIO_BUFFER_USAGE_STATIC);
+        // NOTE: No size requested, the alias must not allocate (and leak) its own copy of the samples
+        AudioBuffer* audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
         if (audioBuffer == NULL)
         {
             TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
+        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
+        audioBuffer->volume = source.stream.buffer->volume;
         audioBuffer->data = source.stream.buffer->data;
         sound.frameCount = source.frameCount;
         sound.stream.sampleRate = AUDIO.System.device.sampleRate;
@@ -974,8 +1052,8 @@ void UnloadSoundAlias(Sound alias)
     // untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         UntrackAudioBuffer(alias.stream.buffer);
+        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         RL_FREE(alias.stream.buffer);
     }
 }
@@ -985,10 +1063,14 @@ void UpdateSound(Sound sound, const void *data, int sampleCount)
 {
     if (sound.stream.buffer != NULL)
     {
-        StopAudioBuffer(sound.stream.buffer);
-
-        // TODO: May want to lock/unlock this since this data buffer is read at mixing time
-        memcpy(sound.stream.buffer->data, data, sampleCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
+        // The data buffer is read at mixing time, stop and refill it while the mixer is out
+        ma_mutex_lock(&AUDIO.System.lock);
+        {
+            DrainAudioCommands();
+            ResetAudioBuffer(sound.stream.buffer);
+            memcpy(sound.stream.buffer->data, data, sampleCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
@@ -2383,7 +2465,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBuffer(audioBuffer);
+                ResetAudioBuffer(audioBuffer);
                 break;
             }
         }
@@ -2450,6 +2532,134 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     return totalOutputFramesProcessed;
 }
 
+// Queue a command for the mixer
+// NOTE: The game thread is the only producer and the lock holder the only consumer, so the
+// common path is two atomic loads and a store; the lock is only taken when the queue is full
+static void PushAudioCommand(AudioBuffer *buffer, int type, float value)
+{
+    AudioCommand command = { buffer, type, value };
+
+    if (!AUDIO.System.isReady)
+    {
+        // No mixer running, nothing to race with
+        ExecuteAudioCommand(command);
+        return;
+    }
+
+    bool isStateCommand = (type <= AUDIO_COMMAND_RESUME);
+
+    if (isStateCommand)
+    {
+        // Track the state the buffer will have once the queue is drained, for IsAudioBufferPlaying()
+        if (c89atomic_load_explicit_32(&buffer->pendingStateCommands, c89atomic_memory_order_acquire) == 0)
+        {
+            buffer->queuedPlaying = buffer->playing;
+            buffer->queuedPaused = buffer->paused;
+        }
+
+        switch (type)
+        {
+            case AUDIO_COMMAND_PLAY: buffer->queuedPlaying = true; buffer->queuedPaused = false; break;
+            case AUDIO_COMMAND_STOP:
+            {
+                if (buffer->queuedPlaying && !buffer->queuedPaused) buffer->queuedPlaying = false;
+            } break;
+            case AUDIO_COMMAND_PAUSE: buffer->queuedPaused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->queuedPaused = false; break;
+            default: break;
+        }
+    }
+
+    ma_uint32 head = c89atomic_load_explicit_32(&AUDIO.Command.head, c89atomic_memory_order_relaxed);
+    ma_uint32 tail = c89atomic_load_explicit_32(&AUDIO.Command.tail, c89atomic_memory_order_acquire);
+
+    if ((head - tail) < AUDIO_COMMAND_QUEUE_SIZE)
+    {
+        if (isStateCommand) c89atomic_fetch_add_32(&buffer->pendingStateCommands, 1);
+
+        AUDIO.Command.queue[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+        c89atomic_store_explicit_32(&AUDIO.Command.head, head + 1, c89atomic_memory_order_release);
+    }
+    else
+    {
+        // Queue full: run everything queued so far and then this command, keeping call order
+        ma_mutex_lock(&AUDIO.System.lock);
+        {
+            DrainAudioCommands();
+            ExecuteAudioCommand(command);
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Run an audio buffer command
+static void ExecuteAudioCommand(AudioCommand command)
+{
+    AudioBuffer *buffer = command.buffer;
+
+    switch (command.type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            buffer->playing = true;
+            buffer->paused = false;
+            buffer->frameCursorPos = 0;
+        } break;
+        case AUDIO_COMMAND_STOP: ResetAudioBuffer(buffer); break;
+        case AUDIO_COMMAND_PAUSE: buffer->paused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->paused = false; break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command.value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is just an adjustment of the sample rate.
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command.value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command.value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command.value; break;
+        default: break;
+    }
+}
+
+// Run all queued audio buffer commands
+// NOTE: AUDIO.System.lock must be held, it is what makes the lock holder the single consumer
+static void DrainAudioCommands(void)
+{
+    ma_uint32 tail = c89atomic_load_explicit_32(&AUDIO.Command.tail, c89atomic_memory_order_relaxed);
+    ma_uint32 head = c89atomic_load_explicit_32(&AUDIO.Command.head, c89atomic_memory_order_acquire);
+
+    while (tail != head)
+    {
+        AudioCommand command = AUDIO.Command.queue[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+
+        ExecuteAudioCommand(command);
+        if (command.type <= AUDIO_COMMAND_RESUME) c89atomic_fetch_sub_32(&command.buffer->pendingStateCommands, 1);
+
+        tail++;
+    }
+
+    c89atomic_store_explicit_32(&AUDIO.Command.tail, tail, c89atomic_memory_order_release);
+}
+
+// Stop an audio buffer immediately
+// NOTE: Only for code that already owns the mixer state (audio callback or lock holder)
+static void ResetAudioBuffer(AudioBuffer *buffer)
+{
+    if (buffer->playing && !buffer->paused)
+    {
+        buffer->playing = false;
+        buffer->paused = false;
+        buffer->frameCursorPos = 0;
+        buffer->framesProcessed = 0;
+        buffer->isSubBufferProcessed[0] = true;
+        buffer->isSubBufferProcessed[1] = true;
+    }
+}
+
 // Sending audio data to device callback function
 // This function will be called when miniaudio needs more data
 // NOTE: All the mixing takes place here
@@ -2457,13 +2667,17 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    TRACE_EVENT_BEGIN("OnSendAudioDataToDevice");
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
+    // The mutex only guards the buffer list and processors now (load/unload), play/stop/volume
+    // calls reach the mixer through the command queue and never wait on it
     ma_mutex_lock(&AUDIO.System.lock);
     {
+        DrainAudioCommands();
+
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
             // Ignore stopped or paused sounds
@@ -2519,7 +2733,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     {
                         if (!audioBuffer->looping)
                         {
-                            StopAudioBuffer(audioBuffer);
+                            ResetAudioBuffer(audioBuffer);
                             break;
                         }
                         else
@@ -2547,6 +2761,8 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     }
 
     ma_mutex_unlock(&AUDIO.System.lock);
+
+    TRACE_EVENT_END("OnSendAudioDataToDevice");
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2564,32 +2780,129 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
         const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+        // Interleaved samples: left level on even ones, right level on odd ones
+        mixSamples(framesOut, framesIn, frameCount*2, levels[0], levels[1]);
+    }
+    else  // We do not consider panning
+    {
+        // Output accumulates input multiplied by volume to provided output (usually 0)
+        mixSamples(framesOut, framesIn, frameCount*channels, localVolume, localVolume);
+    }
+}
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+// Mix samples, portable version (also handles the tails of the SIMD versions)
+static void MixSamplesScalar(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    ma_uint32 i = 0;
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+    for (; i + 1 < sampleCount; i += 2)
+    {
+        samplesOut[i] += (samplesIn[i]*gainEven);
+        samplesOut[i + 1] += (samplesIn[i + 1]*gainOdd);
     }
-    else  // We do not consider panning
+
+    if (i < sampleCount) samplesOut[i] += (samplesIn[i]*gainEven);
+}
+
+#if defined(RAUDIO_MIX_SSE2)
+// Mix samples, 4 per iteration
+static void MixSamplesSSE2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    const __m128 gain = _mm_setr_ps(gainEven, gainOdd, gainEven, gainOdd);
+    const float *in = samplesIn;
+    float *out = samplesOut;
+
+    // NOTE: Walking pointers with a block count keeps 32-bit index math out of the loop
+    for (ma_uint32 block = sampleCount/8; block > 0; block--, in += 8, out += 8)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_loadu_ps(in), gain));
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_loadu_ps(in + 4), gain));
+        _mm_storeu_ps(out, out0);
+        _mm_storeu_ps(out + 4, out1);
+    }
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    // Multiple of 8 done, so the tail starts on an even sample and keeps the gain parity
+    MixSamplesScalar(out, in, sampleCount%8, gainEven, gainOdd);
+}
+#endif
+
+#if defined(RAUDIO_MIX_AVX)
+// Mix samples, 8 per iteration
+RAUDIO_TARGET_AVX static void MixSamplesAVX(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    const __m256 gain = _mm256_setr_ps(gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd);
+    const float *in = samplesIn;
+    float *out = samplesOut;
+
+    for (ma_uint32 block = sampleCount/16; block > 0; block--, in += 16, out += 16)
+    {
+        __m256 out0 = _mm256_add_ps(_mm256_loadu_ps(out), _mm256_mul_ps(_mm256_loadu_ps(in), gain));
+        __m256 out1 = _mm256_add_ps(_mm256_loadu_ps(out + 8), _mm256_mul_ps(_mm256_loadu_ps(in + 8), gain));
+        _mm256_storeu_ps(out, out0);
+        _mm256_storeu_ps(out + 8, out1);
+    }
+
+    _mm256_zeroupper();     // Avoid AVX-SSE transition stalls in the caller
+
+    MixSamplesScalar(out, in, sampleCount%16, gainEven, gainOdd);
+}
+
+// Check CPU and OS support for AVX (the OS must save YMM registers)
+static bool IsCpuAVXSupported(void)
+{
+#if defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 1);
+
+    bool osxsave = ((info[2] & (1 << 27)) != 0);
+    bool avx = ((info[2] & (1 << 28)) != 0);
+
+    return (osxsave && avx && ((_xgetbv(0) & 0x6) == 0x6));
+#else
+    __builtin_cpu_init();
+    return (__builtin_cpu_supports("avx") != 0);
+#endif
+}
+#endif
+
+#if defined(RAUDIO_MIX_NEON)
+// Mix samples, 4 per iteration
+static void MixSamplesNEON(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    const float gains[4] = { gainEven, gainOdd, gainEven, gainOdd };
+    const float32x4_t gain = vld1q_f32(gains);
+    const float *in = samplesIn;
+    float *out = samplesOut;
+
+    // NOTE: Separate multiply and add (no fused vmla/vfma) to match the scalar rounding
+    for (ma_uint32 block = sampleCount/8; block > 0; block--, in += 8, out += 8)
+    {
+        float32x4_t out0 = vaddq_f32(vld1q_f32(out), vmulq_f32(vld1q_f32(in), gain));
+        float32x4_t out1 = vaddq_f32(vld1q_f32(out + 4), vmulq_f32(vld1q_f32(in + 4), gain));
+        vst1q_f32(out, out0);
+        vst1q_f32(out + 4, out1);
     }
+
+    MixSamplesScalar(out, in, sampleCount%8, gainEven, gainOdd);
+}
+#endif
+
+// Best kernel for this CPU
+static MixSamplesFunc SelectMixSamplesKernel(const char **name)
+{
+#if defined(RAUDIO_MIX_AVX)
+    if (IsCpuAVXSupported()) { if (name != NULL) *name = "AVX"; return MixSamplesAVX; }
+#endif
+#if defined(RAUDIO_MIX_SSE2)
+    if (name != NULL) *name = "SSE2";
+    return MixSamplesSSE2;
+#elif defined(RAUDIO_MIX_NEON)
+    if (name != NULL) *name = "NEON";
+    return MixSamplesNEON;
+#else
+    if (name != NULL) *name = "scalar";
+    return MixSamplesScalar;
+#endif
 }
 
 // Some required functions for audio standalone module version
@@ -922,6 +922,7 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*TraceEventCallback)(const char *name, bool begin);       // Profiling: Timed section opened (begin) or closed on the calling thread
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1074,6 +1075,7 @@ RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
+RLAPI void SetTraceEventCallback(TraceEventCallback callback);     // Set custom timeline hook (buffer swap, frame wait, audio mixing), set it before InitAudioDevice()
 
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
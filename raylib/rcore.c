@@ -10,6 +10,7 @@
 *       - PLATFORM_ANDROID: Android (ARM, ARM64)
 *       - PLATFORM_DRM:     Linux native mode, including Raspberry Pi 4 with V3D fkms driver
 *       - PLATFORM_WEB:     HTML5 with WebAssembly
+*       - PLATFORM_NULL:    Headless, no window, input or GPU (CI and benchmarking)
 *
 *   CONFIGURATION:
 *       #define PLATFORM_DESKTOP
@@ -28,6 +29,14 @@
 *           Windowing and input system configured for HTML5 (run on browser), code converted from C to asm.js
 *           using emscripten compiler. OpenGL ES 2.0 required for direct translation to WebGL equivalent code.
 *
+*       #define PLATFORM_NULL
+*           No window, input or graphics device. rlgl runs unchanged (batching, matrices, shader and texture
+*           bookkeeping) on top of a stub OpenGL 3.3 loader whose functions do nothing, so the CPU side of
+*           drawing can be measured on machines without a display or GPU. Nothing is rasterized: screen and
+*           texture reads return no pixels. WaitTime() doesn't sleep, it advances GetTime() instead, so a
+*           target FPS gives fixed frame times without wall-clock waits.
+*           NOTE: Requires GRAPHICS_API_OPENGL_33
+*
 *       #define SUPPORT_DEFAULT_FONT (default)
 *           Default font is loaded on window initialization to be available for the user to render simple text.
 *           NOTE: If enabled, uses external module functions to load default raylib font (module: text)
@@ -150,7 +159,7 @@
 #endif
 
 // Platform specific defines to handle GetApplicationDirectory()
-#if defined (PLATFORM_DESKTOP)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_NULL)
     #if defined(_WIN32)
         #ifndef MAX_PATH
             #define MAX_PATH 1025
@@ -164,7 +173,7 @@
         #include <sys/syslimits.h>
         #include <mach-o/dyld.h>
     #endif // OSs
-#endif // PLATFORM_DESKTOP
+#endif // PLATFORM_DESKTOP || PLATFORM_NULL
 
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
@@ -179,7 +188,7 @@
     #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #endif
 
-#if defined(PLATFORM_DESKTOP) && defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
+#if (defined(PLATFORM_DESKTOP) || defined(PLATFORM_NULL)) && defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #define DIRENT_MALLOC RL_MALLOC
     #define DIRENT_FREE RL_FREE
 
@@ -489,8 +498,11 @@ typedef struct CoreData {
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
         double target;                      // Desired time for one frame, if 0 not applied
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM) || defined(PLATFORM_NULL)
         unsigned long long int base;        // Base time measure for hi-res timer
+#endif
+#if defined(PLATFORM_NULL)
+        double skipped;                     // Time WaitTime() skipped instead of sleeping
 #endif
         unsigned int frameCounter;          // Frame counter
     } Time;
@@ -503,8 +515,8 @@ RLAPI const char *raylib_version = RAYLIB_VERSION;  // raylib version exported s
 
 static CoreData CORE = { 0 };               // Global CORE state context
 
-#if defined(SUPPORT_SCREEN_CAPTURE)
-static int screenshotCounter = 0;           // Screenshots counter
+#if defined(SUPPORT_SCREEN_CAPTURE) && !defined(PLATFORM_NULL)
+static int screenshotCounter = 0;           // Screenshots counter (F12 key)
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
@@ -675,6 +687,10 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 
 #endif  // PLATFORM_DRM
 
+#if defined(PLATFORM_NULL)
+static GLADapiproc NullGetProcAddress(const char *name);  // Stub OpenGL loader for the null platform
+#endif
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
 static void LoadAutomationEvents(const char *fileName);     // Load automation events from file
 static void ExportAutomationEvents(const char *fileName);   // Export recorded automation events into a file
@@ -687,6 +703,12 @@ static void PlayAutomationEvent(unsigned int frame);        // Play frame events
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
 #endif
 
+#if defined(PLATFORM_NULL) && defined(_WIN32)
+// NOTE: Declared here for the same reason, LARGE_INTEGER is passed as its 64-bit QuadPart
+int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);      // Required for: GetTime(), InitTimer()
+int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);          // Required for: GetTime()
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 const char *TextFormat(const char *text, ...);       // Formatting of text with variables to 'embed'
 #endif // !SUPPORT_MODULE_RTEXT
@@ -842,7 +864,7 @@ void InitWindow(int width, int height, const char *title)
         }
     }
 #endif
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_DRM) || defined(PLATFORM_NULL)
     // Initialize graphics device (display device and OpenGL context)
     // NOTE: returns true if window and graphic device has been initialized successfully
     CORE.Window.ready = InitGraphicsDevice(width, height);
@@ -943,7 +965,7 @@ void InitWindow(int width, int height, const char *title)
     CORE.Time.frameCounter = 0;
 #endif
 
-#endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_DRM
+#endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_DRM || PLATFORM_NULL
 }
 
 // Close window and unload OpenGL context
@@ -969,7 +991,7 @@ void CloseWindow(void)
     glfwTerminate();
 #endif
 
-#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
+#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_NULL)
     timeEndPeriod(1);           // Restore time period
 #endif
 
@@ -1123,7 +1145,7 @@ bool WindowShouldClose(void)
     else return true;
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM) || defined(PLATFORM_NULL)
     if (CORE.Window.ready) return CORE.Window.shouldClose;
     else return true;
 #endif
@@ -2364,7 +2386,9 @@ void EndDrawing(void)
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    TRACE_EVENT_BEGIN("SwapScreenBuffer");
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    TRACE_EVENT_END("SwapScreenBuffer");
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -2376,7 +2400,9 @@ void EndDrawing(void)
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
     {
+        TRACE_EVENT_BEGIN("WaitTime");
         WaitTime(CORE.Time.target - CORE.Time.frame);
+        TRACE_EVENT_END("WaitTime");
 
         CORE.Time.current = GetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
@@ -3059,12 +3085,23 @@ double GetTime(void)
     time = glfwGetTime();   // Elapsed time since glfwInit()
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM) || (defined(PLATFORM_NULL) && !defined(_WIN32))
     struct timespec ts = { 0 };
     clock_gettime(CLOCK_MONOTONIC, &ts);
     unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
 
     time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
+#endif
+#if defined(PLATFORM_NULL) && defined(_WIN32)
+    unsigned long long int counter = 0;
+    unsigned long long int frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    time = (double)(counter - CORE.Time.base)/(double)frequency;  // Elapsed time since InitTimer()
+#endif
+#if defined(PLATFORM_NULL)
+    time += CORE.Time.skipped;      // Waits are skipped, not slept
 #endif
     return time;
 }
@@ -4945,10 +4982,37 @@ static bool InitGraphicsDevice(int width, int height)
     }
 #endif  // PLATFORM_ANDROID || PLATFORM_DRM
 
+#if defined(PLATFORM_NULL)
+    // No display: the "display" is the requested size and everything renders 1:1 into it
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Null platform requires an explicit window size");
+        return false;
+    }
+
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+    // At this point we need to manage render size vs screen size
+    // NOTE: This function use and modify global module variables:
+    //  -> CORE.Window.screen.width/CORE.Window.screen.height
+    //  -> CORE.Window.render.width/CORE.Window.render.height
+    //  -> CORE.Window.screenScale
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Null device initialized successfully (no rendering)");
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+#endif  // PLATFORM_NULL
+
     // Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     rlLoadExtensions(glfwGetProcAddress);
+#elif defined(PLATFORM_NULL)
+    rlLoadExtensions(NullGetProcAddress);
 #else
     rlLoadExtensions(eglGetProcAddress);
 #endif
@@ -4979,7 +5043,7 @@ static void SetupViewport(int width, int height)
     // Set viewport width and height
     // NOTE: We consider render size (scaled) and offset in case black bars are required and
     // render area does not match full display area (this situation is only applicable on fullscreen mode)
-#if defined(__APPLE__)
+#if defined(__APPLE__) && !defined(PLATFORM_NULL)
     float xScale = 1.0f, yScale = 1.0f;
     glfwGetWindowContentScale(CORE.Window.handle, &xScale, &yScale);
     rlViewport(CORE.Window.renderOffset.x/2*xScale, CORE.Window.renderOffset.y/2*yScale, (CORE.Window.render.width)*xScale, (CORE.Window.render.height)*yScale);
@@ -5083,11 +5147,15 @@ static void InitTimer(void)
 // However, it can also reduce overall system performance, because the thread scheduler switches tasks more often.
 // High resolutions can also prevent the CPU power management system from entering power-saving modes.
 // Setting a higher resolution does not improve the accuracy of the high-resolution performance counter.
-#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
+#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_NULL)
     timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_NULL) && defined(_WIN32)
+    QueryPerformanceCounter(&CORE.Time.base);   // Performance counter ticks, GetTime() divides by the frequency
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_DRM) || (defined(PLATFORM_NULL) && !defined(_WIN32))
     struct timespec now = { 0 };
 
     if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
@@ -5107,6 +5175,12 @@ static void InitTimer(void)
 // Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timing on Win32!
 void WaitTime(double seconds)
 {
+#if defined(PLATFORM_NULL)
+    // No display to pace against: jump the clock ahead so frame times still match the target
+    if (seconds > 0.0) CORE.Time.skipped += seconds;
+    return;
+#endif
+
 #if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
@@ -7183,6 +7257,85 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 }
 #endif
 
+#if defined(PLATFORM_NULL)
+// Null OpenGL: object names are handed out from a counter so rlgl sees valid ids (0 means failure),
+// queries report a complete OpenGL 3.3 context, and everything else returns without doing anything
+static GLuint nullObjectCounter = 0;
+
+static const GLubyte *GLAD_API_PTR NullGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"Null renderer";
+        case GL_VERSION: return (const GLubyte *)"3.3 Null";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30";
+        default: return (const GLubyte *)"";
+    }
+}
+
+// One extension, glad treats a context that lists none as unusable
+static const GLubyte *GLAD_API_PTR NullGetStringi(GLenum name, GLuint index)
+{
+    return ((name == GL_EXTENSIONS) && (index == 0))? (const GLubyte *)"GL_RAYLIB_null" : NULL;
+}
+
+static void GLAD_API_PTR NullGetIntegerv(GLenum pname, GLint *data)
+{
+    *data = (pname == GL_NUM_EXTENSIONS)? 1 : 0;
+}
+
+static void GLAD_API_PTR NullGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    (void)shader;
+    *params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0;
+}
+
+static void GLAD_API_PTR NullGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    (void)program;
+    *params = (pname == GL_LINK_STATUS)? GL_TRUE : 0;
+}
+
+static GLuint GLAD_API_PTR NullCreateObject(GLenum type)
+{
+    (void)type;
+    return ++nullObjectCounter;
+}
+
+static void GLAD_API_PTR NullGenObjects(GLsizei n, GLuint *ids)
+{
+    for (int i = 0; i < n; i++) ids[i] = ++nullObjectCounter;
+}
+
+static GLenum GLAD_API_PTR NullCheckFramebufferStatus(GLenum target)
+{
+    (void)target;
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+// NOTE: Called through every other GL function pointer type, which relies on the caller cleaning
+// up the arguments (x86-64, ARM64 and 32-bit cdecl; not 32-bit Windows, where GL uses stdcall)
+static void *NullNoOp(void)
+{
+    return NULL;
+}
+
+static GLADapiproc NullGetProcAddress(const char *name)
+{
+    if (strcmp(name, "glGetString") == 0) return (GLADapiproc)NullGetString;
+    if (strcmp(name, "glGetStringi") == 0) return (GLADapiproc)NullGetStringi;
+    if (strcmp(name, "glGetIntegerv") == 0) return (GLADapiproc)NullGetIntegerv;
+    if (strcmp(name, "glGetShaderiv") == 0) return (GLADapiproc)NullGetShaderiv;
+    if (strcmp(name, "glGetProgramiv") == 0) return (GLADapiproc)NullGetProgramiv;
+    if ((strcmp(name, "glCreateShader") == 0) || (strcmp(name, "glCreateProgram") == 0)) return (GLADapiproc)NullCreateObject;
+    if ((strncmp(name, "glGen", 5) == 0) && (strncmp(name, "glGenerate", 10) != 0)) return (GLADapiproc)NullGenObjects;
+    if (strcmp(name, "glCheckFramebufferStatus") == 0) return (GLADapiproc)NullCheckFramebufferStatus;
+
+    return (GLADapiproc)NullNoOp;
+}
+#endif  // PLATFORM_NULL
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
 // NOTE: Loading happens over AutomationEvent *events
 // TODO: This system should probably be redesigned
@@ -101,11 +101,27 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_GLYPH_LOOKUP_FONTS
+    #define MAX_GLYPH_LOOKUP_FONTS                16        // Maximum number of loaded fonts with a codepoint lookup table: GetGlyphIndex()
+#endif
+
+#define GLYPH_LOOKUP_PAGE_COUNT                  256        // BMP (U+0000..U+FFFF) split in 256 pages...
+#define GLYPH_LOOKUP_PAGE_SIZE                   256        // ...of 256 codepoints each
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Codepoint to glyph index table, built when a font is loaded
+// NOTE: Font struct is part of the public API, so tables live on the side, keyed by the glyphs array
+typedef struct GlyphLookup {
+    const GlyphInfo *glyphs;        // Glyphs array of the font (NULL for a free slot)
+    int glyphCount;                 // Number of glyphs when the table was built
+    int fallbackIndex;              // Index of '?' glyph, returned for missing codepoints
+    int *pages[GLYPH_LOOKUP_PAGE_COUNT];    // BMP: glyph index + 1 (0: missing), pages allocated on demand
+    int *hashKeys;                  // Other codepoints: open addressing table
+    int *hashValues;                // Glyph index + 1 (0: empty slot)
+    int hashCapacity;               // Power of two, 0 if no glyph outside the BMP
+} GlyphLookup;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -116,6 +132,9 @@
 static Font defaultFont = { 0 };
 #endif
 
+static GlyphLookup glyphLookups[MAX_GLYPH_LOOKUP_FONTS] = { 0 };  // Codepoint lookup tables of loaded fonts
+static int lastGlyphLookup = 0;                                    // Slot that answered the last query
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -129,6 +148,10 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #endif
 static int textLineSpacing = 15;                // Text vertical line spacing in pixels
 
+static void LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);   // Build codepoint lookup table for a font glyphs array
+static void UnloadGlyphLookup(const GlyphInfo *glyphs);                 // Free codepoint lookup table (if any)
+static GlyphLookup *FindGlyphLookup(const GlyphInfo *glyphs, int glyphCount);   // Get lookup table for glyphs array, NULL if not registered
+
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
@@ -284,6 +307,8 @@ extern void LoadFontDefault(void)
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
 
+    LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
+
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
 
@@ -292,6 +317,7 @@ extern void UnloadFontDefault(void)
 {
     for (int i = 0; i < defaultFont.glyphCount; i++) UnloadImage(defaultFont.glyphs[i].image);
     UnloadTexture(defaultFont.texture);
+    UnloadGlyphLookup(defaultFont.glyphs);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
 }
@@ -500,6 +526,8 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
 
     font.baseSize = (int)font.recs[0].height;
 
+    LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     return font;
 }
 
@@ -536,6 +564,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            LoadGlyphLookup(font.glyphs, font.glyphCount);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -892,6 +922,7 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
     {
         for (int i = 0; i < glyphCount; i++) UnloadImage(glyphs[i].image);
 
+        UnloadGlyphLookup(glyphs);
         RL_FREE(glyphs);
     }
 }
@@ -1294,6 +1325,31 @@ int GetGlyphIndex(Font font, int codepoint)
 
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
+    // Fonts loaded by raylib have a lookup table, O(1) per codepoint
+    GlyphLookup *lookup = FindGlyphLookup(font.glyphs, font.glyphCount);
+
+    if (lookup != NULL)
+    {
+        int entry = 0;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGE_COUNT*GLYPH_LOOKUP_PAGE_SIZE))
+        {
+            int *page = lookup->pages[codepoint/GLYPH_LOOKUP_PAGE_SIZE];
+            if (page != NULL) entry = page[codepoint%GLYPH_LOOKUP_PAGE_SIZE];
+        }
+        else if (lookup->hashCapacity > 0)
+        {
+            unsigned int mask = (unsigned int)lookup->hashCapacity - 1;
+            for (unsigned int i = ((unsigned int)codepoint*2654435761u) & mask; lookup->hashValues[i] != 0; i = (i + 1) & mask)
+            {
+                if (lookup->hashKeys[i] == codepoint) { entry = lookup->hashValues[i]; break; }
+            }
+        }
+
+        return (entry > 0)? (entry - 1) : lookup->fallbackIndex;
+    }
+
+    // Fonts assembled by hand (not registered): scan the unordered charset
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
     // Look for character index in the unordered charset
@@ -2136,10 +2192,121 @@ static Font LoadBMFont(const char *fileName)
         font = GetFontDefault();
         TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
     }
-    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    else
+    {
+        LoadGlyphLookup(font.glyphs, font.glyphCount);
+        TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    }
 
     return font;
 }
 #endif
 
+// Build codepoint lookup table for a font glyphs array
+// NOTE: Matches the linear scan: first glyph wins on duplicated codepoints, fallback is the last '?'
+static void LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return;
+
+    UnloadGlyphLookup(glyphs);      // Reused allocation, drop any stale table
+
+    GlyphLookup *lookup = NULL;
+    for (int i = 0; i < MAX_GLYPH_LOOKUP_FONTS; i++)
+    {
+        if (glyphLookups[i].glyphs == NULL) { lookup = &glyphLookups[i]; break; }
+    }
+
+    if (lookup == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Glyph lookup tables limit reached (%i), using linear search", MAX_GLYPH_LOOKUP_FONTS);
+        return;
+    }
+
+    // Size the hash for codepoints outside the BMP at load factor <= 0.5
+    int outsideCount = 0;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if ((glyphs[i].value < 0) || (glyphs[i].value >= GLYPH_LOOKUP_PAGE_COUNT*GLYPH_LOOKUP_PAGE_SIZE)) outsideCount++;
+    }
+
+    if (outsideCount > 0)
+    {
+        lookup->hashCapacity = 1;
+        while (lookup->hashCapacity < outsideCount*2) lookup->hashCapacity *= 2;
+        lookup->hashKeys = (int *)RL_CALLOC(lookup->hashCapacity, sizeof(int));
+        lookup->hashValues = (int *)RL_CALLOC(lookup->hashCapacity, sizeof(int));
+    }
+
+    lookup->glyphs = glyphs;
+    lookup->glyphCount = glyphCount;
+    lookup->fallbackIndex = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+        if (codepoint == 63) lookup->fallbackIndex = i;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_PAGE_COUNT*GLYPH_LOOKUP_PAGE_SIZE))
+        {
+            int **page = &lookup->pages[codepoint/GLYPH_LOOKUP_PAGE_SIZE];
+            if (*page == NULL) *page = (int *)RL_CALLOC(GLYPH_LOOKUP_PAGE_SIZE, sizeof(int));
+            if ((*page)[codepoint%GLYPH_LOOKUP_PAGE_SIZE] == 0) (*page)[codepoint%GLYPH_LOOKUP_PAGE_SIZE] = i + 1;
+        }
+        else
+        {
+            unsigned int mask = (unsigned int)lookup->hashCapacity - 1;
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+            while ((lookup->hashValues[slot] != 0) && (lookup->hashKeys[slot] != codepoint)) slot = (slot + 1) & mask;
+
+            if (lookup->hashValues[slot] == 0)
+            {
+                lookup->hashKeys[slot] = codepoint;
+                lookup->hashValues[slot] = i + 1;
+            }
+        }
+    }
+}
+
+// Free codepoint lookup table (if any)
+static void UnloadGlyphLookup(const GlyphInfo *glyphs)
+{
+    if (glyphs == NULL) return;
+
+    for (int i = 0; i < MAX_GLYPH_LOOKUP_FONTS; i++)
+    {
+        GlyphLookup *lookup = &glyphLookups[i];
+
+        if (lookup->glyphs == glyphs)
+        {
+            for (int p = 0; p < GLYPH_LOOKUP_PAGE_COUNT; p++) RL_FREE(lookup->pages[p]);
+            RL_FREE(lookup->hashKeys);
+            RL_FREE(lookup->hashValues);
+            memset(lookup, 0, sizeof(GlyphLookup));
+        }
+    }
+}
+
+// Get lookup table for glyphs array, NULL if not registered
+static GlyphLookup *FindGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if (glyphs == NULL) return NULL;
+
+    // Text is usually drawn with the same font many codepoints in a row
+    GlyphLookup *lookup = &glyphLookups[lastGlyphLookup];
+    if ((lookup->glyphs == glyphs) && (lookup->glyphCount == glyphCount)) return lookup;
+
+    for (int i = 0; i < MAX_GLYPH_LOOKUP_FONTS; i++)
+    {
+        lookup = &glyphLookups[i];
+
+        if ((lookup->glyphs == glyphs) && (lookup->glyphCount == glyphCount))
+        {
+            lastGlyphLookup = i;
+            return lookup;
+        }
+    }
+
+    return NULL;
+}
+
 #endif      // SUPPORT_MODULE_RTEXT
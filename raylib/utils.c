@@ -66,6 +66,7 @@ static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback fun
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
+static TraceEventCallback traceEvent = NULL;        // TraceEvent callback function pointer, also called from the audio thread
 
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
@@ -75,6 +76,13 @@ void SetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = cal
 void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
+void SetTraceEventCallback(TraceEventCallback callback) { traceEvent = callback; }        // Set custom timeline hook
+
+// Report a timed section to the trace event callback, if any
+void TraceEvent(const char *name, bool begin)
+{
+    if (traceEvent != NULL) traceEvent(name, begin);
+}
 
 
 #if defined(PLATFORM_ANDROID)
@@ -45,6 +45,10 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// Timed sections reported to SetTraceEventCallback(), closed on the thread that opened them
+#define TRACE_EVENT_BEGIN(name) TraceEvent(name, true)
+#define TRACE_EVENT_END(name)   TraceEvent(name, false)
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -74,6 +78,8 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+void TraceEvent(const char *name, bool begin);                         // Call the trace event callback, see TRACE_EVENT_BEGIN/END
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,133 @@
+/*******************************************************************************************
+*
+*   Batch simulator: plays many bot games headlessly and reports balance stats
+*
+*   batch_sim [options]
+*     --games N              Games to play (default 1000)
+*     --seed N               Seed of the first game, game i uses seed + i (default 1)
+*     --threads N            Worker threads, 0 = all hardware threads (default 0)
+*     --max-time S           Game seconds before a round is cut off (default 600)
+*     --modifier-chance P    Percent chance a destroyed brick drops a modifier
+*     --bounce M             Paddle bounce multiplier
+*     --row-lives A,B,C...   Brick lives per row from the top, the last value repeats
+*     --aim-error PX         Bot aiming error (default 70)
+*     --scaling              Run the batch at 1, 2, 4... threads and report the speedup
+*
+********************************************************************************************/
+
+#include "BatchRunner.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+static void PrintStats(const BatchConfig& config, const BatchStats& stats, const std::vector<GameResult>& results) {
+    printf("Config: modifier chance %.1f%%, bounce %.2f, row lives", config.sim.modifierChance, config.sim.paddleBounceMultiplier);
+    for (int r = 0; r < CONFIG_ROW_LIVES && r < config.sim.brickRows; ++r) printf(" %d", config.sim.rowLives[r]);
+    printf("\n\n");
+
+    printf("Games           %d (%d lost every ball, %d cut off at %.0f s)\n", stats.games, stats.gamesOver, stats.games - stats.gamesOver, config.maxGameTime);
+    printf("Game time       %.1f s mean\n", stats.durationMean);
+    printf("Score           mean %.0f | min %d  p10 %d  p50 %d  p90 %d  max %d\n",
+        stats.scoreMean, stats.scoreMin, stats.scoreP10, stats.scoreP50, stats.scoreP90, stats.scoreMax);
+    printf("First clear     %d games (%.1f%%), mean %.1f s, median %.1f s\n",
+        stats.gamesWithClear, 100.0 * stats.gamesWithClear / stats.games, stats.firstClearMean, stats.firstClearP50);
+    printf("Levels cleared  %.2f per game\n", stats.levelsClearedMean);
+    printf("Balls lost      %.2f per game\n", stats.ballsLostMean);
+    printf("Modifiers       %.2f collected per game\n", stats.modifiersMean);
+
+    // Score distribution, 10 equal-width buckets between min and max
+    const int buckets = 10;
+    int counts[buckets] = {};
+    double width = (stats.scoreMax - stats.scoreMin) / (double)buckets;
+    for (const GameResult& game : results) {
+        int bucket = (width > 0.0) ? (int)((game.score - stats.scoreMin) / width) : 0;
+        counts[bucket < buckets ? bucket : buckets - 1]++;
+    }
+    int largest = 1;
+    for (int b = 0; b < buckets; ++b) largest = counts[b] > largest ? counts[b] : largest;
+
+    printf("\nScore distribution\n");
+    for (int b = 0; b < buckets; ++b) {
+        printf("  %10.0f+ %7d |", stats.scoreMin + b * width, counts[b]);
+        for (int i = 0; i < counts[b] * 50 / largest; ++i) putchar('#');
+        putchar('\n');
+    }
+
+    printf("\n%llu ticks in %.2f s on %d threads: %.0f games/s, %.1f M ticks/s\n",
+        stats.ticks, stats.wallSeconds, stats.threads, stats.games / stats.wallSeconds, stats.ticks / stats.wallSeconds / 1e6);
+}
+
+static void RunScaling(BatchConfig config) {
+    int maxThreads = (int)std::thread::hardware_concurrency();
+    if (maxThreads <= 0) maxThreads = 1;
+
+    printf("threads   seconds   M ticks/s   speedup   efficiency\n");
+    double baseline = 0.0;
+    // 1, 2, 4... and finally every hardware thread
+    for (int threads = 1; threads <= maxThreads; threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2) {
+        config.threads = threads;
+        BatchStats stats = RunBatch(config);
+        double rate = stats.ticks / stats.wallSeconds;
+        if (threads == 1) baseline = rate;
+        printf("%7d %9.2f %11.1f %8.2fx %11.0f%%\n", threads, stats.wallSeconds, rate / 1e6, rate / baseline, 100.0 * rate / baseline / threads);
+    }
+}
+
+static bool ParseRowLives(const char* text, SimConfig& sim) {
+    int count = 0;
+    const char* cursor = text;
+    while (*cursor != '\0' && count < CONFIG_ROW_LIVES) {
+        char* end;
+        long lives = strtol(cursor, &end, 10);
+        if (end == cursor || lives < 1 || lives > 255) return false;
+        sim.rowLives[count++] = (int)lives;
+        cursor = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') return false;
+    }
+    for (int r = count; r < CONFIG_ROW_LIVES; ++r) sim.rowLives[r] = sim.rowLives[count - 1];
+    return count > 0;
+}
+
+int main(int argc, char** argv) {
+    BatchConfig config = DefaultBatchConfig();
+    bool scaling = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        bool takesValue = true;
+
+        if (strcmp(arg, "--scaling") == 0) { scaling = true; takesValue = false; }
+        else if (value == nullptr) { fprintf(stderr, "Missing value for %s\n", arg); return 1; }
+        else if (strcmp(arg, "--games") == 0) config.games = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) config.firstSeed = (unsigned int)strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--threads") == 0) config.threads = atoi(value);
+        else if (strcmp(arg, "--max-time") == 0) config.maxGameTime = (float)atof(value);
+        else if (strcmp(arg, "--modifier-chance") == 0) config.sim.modifierChance = (float)atof(value);
+        else if (strcmp(arg, "--bounce") == 0) config.sim.paddleBounceMultiplier = (float)atof(value);
+        else if (strcmp(arg, "--aim-error") == 0) config.bot.aimError = (float)atof(value);
+        else if (strcmp(arg, "--row-lives") == 0) {
+            if (!ParseRowLives(value, config.sim)) { fprintf(stderr, "Bad --row-lives '%s'\n", value); return 1; }
+        }
+        else { fprintf(stderr, "Unknown option %s\n", arg); return 1; }
+
+        if (takesValue) i++;
+    }
+
+    if (config.games <= 0) {
+        fprintf(stderr, "--games must be positive\n");
+        return 1;
+    }
+
+    if (scaling) {
+        RunScaling(config);
+        return 0;
+    }
+
+    std::vector<GameResult> results;
+    BatchStats stats = RunBatch(config, &results);
+    PrintStats(config, stats, results);
+    return 0;
+}
@@ -0,0 +1,261 @@
+#include "BenchHarness.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <time.h> // For clock_gettime where available
+#include <memory>
+#include <regex>
+#include <thread>
+
+static std::vector<std::unique_ptr<BenchRegistration>>& Registry() {
+    static std::vector<std::unique_ptr<BenchRegistration>> registry;
+    return registry;
+}
+
+// CPU time of the benchmarking thread. std::clock() is too coarse for benchmarks that
+// pause the timers every iteration, so use the nanosecond thread clock where there is one.
+static double CpuSeconds() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (double)now.tv_sec + now.tv_nsec * 1e-9;
+#else
+    return (double)std::clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+//------------------------------------------------------------------------------------
+// BenchState
+//------------------------------------------------------------------------------------
+BenchState::BenchState(const std::vector<int64_t>& benchArgs, int64_t maxIters)
+    : realSeconds(0.0), cpuSeconds(0.0), itemsProcessed(0),
+      args(benchArgs), maxIterations(maxIters), completed(0), started(false), running(false), cpuStart(0.0) {
+    if (args.empty()) args.push_back(0);
+}
+
+void BenchState::StartTimers() {
+    running = true;
+    cpuStart = CpuSeconds();
+    realStart = std::chrono::steady_clock::now();
+}
+
+void BenchState::StopTimers() {
+    realSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart).count();
+    cpuSeconds += CpuSeconds() - cpuStart;
+    running = false;
+}
+
+bool BenchState::KeepRunning() {
+    if (!started) {
+        started = true;
+        if (!error.empty()) return false;
+        StartTimers();
+        return true;
+    }
+
+    completed++;
+    if (completed < maxIterations && error.empty()) return true;
+
+    if (running) StopTimers();
+    return false;
+}
+
+void BenchState::PauseTiming() {
+    if (running) StopTimers();
+}
+
+void BenchState::ResumeTiming() {
+    if (!running) StartTimers();
+}
+
+void BenchState::SkipWithError(const char* message) {
+    error = message;
+}
+
+//------------------------------------------------------------------------------------
+// Registration
+//------------------------------------------------------------------------------------
+BenchRegistration::BenchRegistration(const char* benchName, BenchFunction benchFunction)
+    : name(benchName), function(benchFunction) {
+}
+
+BenchRegistration* BenchRegistration::Arg(int64_t value) {
+    argSets.push_back({ value });
+    return this;
+}
+
+BenchRegistration* BenchRegistration::Args(std::initializer_list<int64_t> values) {
+    argSets.push_back(values);
+    return this;
+}
+
+BenchRegistration* RegisterBenchmark(const char* name, BenchFunction function) {
+    Registry().emplace_back(new BenchRegistration(name, function));
+    return Registry().back().get();
+}
+
+//------------------------------------------------------------------------------------
+// Runner
+//------------------------------------------------------------------------------------
+struct BenchResult {
+    std::string name;
+    int64_t iterations;
+    double realNs; // Per iteration
+    double cpuNs;
+    double itemsPerSecond;
+    std::string label;
+    std::string error;
+};
+
+static std::string RunName(const BenchRegistration& bench, const std::vector<int64_t>& args) {
+    std::string name = bench.name;
+    for (int64_t arg : args) name += "/" + std::to_string(arg);
+    return name;
+}
+
+static BenchResult RunOne(const BenchRegistration& bench, const std::vector<int64_t>& args, double minTime) {
+    BenchResult result;
+    result.name = RunName(bench, args);
+
+    // Grow the batch until it is long enough to time, aiming a little past minTime
+    int64_t iterations = 1;
+    for (;;) {
+        BenchState state(args, iterations);
+        bench.function(state);
+
+        if (!state.error.empty() || state.realSeconds >= minTime || iterations >= 1000000000) {
+            result.iterations = state.iterations();
+            result.realNs = state.iterations() > 0 ? state.realSeconds * 1e9 / state.iterations() : 0.0;
+            result.cpuNs = state.iterations() > 0 ? state.cpuSeconds * 1e9 / state.iterations() : 0.0;
+            result.itemsPerSecond = (state.itemsProcessed > 0 && state.realSeconds > 0.0) ? state.itemsProcessed / state.realSeconds : 0.0;
+            result.label = state.label;
+            result.error = state.error;
+            return result;
+        }
+
+        double multiplier = state.realSeconds > 0.0 ? minTime * 1.4 / state.realSeconds : 10.0;
+        if (multiplier > 10.0 || state.realSeconds / minTime < 0.1) multiplier = 10.0;
+        iterations = (int64_t)(iterations * multiplier) + 1;
+    }
+}
+
+static void PrintConsole(const BenchResult& r) {
+    if (!r.error.empty()) {
+        printf("%-44s SKIPPED: %s\n", r.name.c_str(), r.error.c_str());
+        return;
+    }
+    printf("%-44s %12.1f ns %12.1f ns %12lld", r.name.c_str(), r.realNs, r.cpuNs, (long long)r.iterations);
+    if (r.itemsPerSecond > 0.0) printf("  %8.2f M items/s", r.itemsPerSecond / 1e6);
+    if (!r.label.empty()) printf("  %s", r.label.c_str());
+    printf("\n");
+}
+
+static void WriteJson(FILE* file, const std::vector<BenchResult>& results) {
+    char date[64];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    fprintf(file, "{\n  \"context\": {\n");
+    fprintf(file, "    \"date\": \"%s\",\n", date);
+    fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#if defined(NDEBUG)
+    fprintf(file, "    \"library_build_type\": \"release\"\n");
+#else
+    fprintf(file, "    \"library_build_type\": \"debug\"\n");
+#endif
+    fprintf(file, "  },\n  \"benchmarks\": [");
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        fprintf(file, "%s\n    {\n", i > 0 ? "," : "");
+        fprintf(file, "      \"name\": \"%s\",\n      \"run_name\": \"%s\",\n      \"run_type\": \"iteration\",\n", r.name.c_str(), r.name.c_str());
+        if (!r.error.empty()) {
+            fprintf(file, "      \"error_occurred\": true,\n      \"error_message\": \"%s\"\n    }", r.error.c_str());
+            continue;
+        }
+        fprintf(file, "      \"iterations\": %lld,\n", (long long)r.iterations);
+        fprintf(file, "      \"real_time\": %.4f,\n      \"cpu_time\": %.4f,\n      \"time_unit\": \"ns\"", r.realNs, r.cpuNs);
+        if (r.itemsPerSecond > 0.0) fprintf(file, ",\n      \"items_per_second\": %.6e", r.itemsPerSecond);
+        if (!r.label.empty()) fprintf(file, ",\n      \"label\": \"%s\"", r.label.c_str());
+        fprintf(file, "\n    }");
+    }
+    fprintf(file, "\n  ]\n}\n");
+}
+
+static const char* FlagValue(const char* arg, const char* flag) {
+    size_t length = strlen(flag);
+    if (strncmp(arg, flag, length) == 0 && arg[length] == '=') return arg + length + 1;
+    return nullptr;
+}
+
+int RunBenchmarks(int argc, char** argv) {
+    std::string filter = ".";
+    double minTime = 0.5;
+    bool json = false;
+    bool listOnly = false;
+    const char* outFile = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* value;
+        if ((value = FlagValue(argv[i], "--benchmark_filter"))) filter = value;
+        else if ((value = FlagValue(argv[i], "--benchmark_min_time"))) minTime = atof(value);
+        else if ((value = FlagValue(argv[i], "--benchmark_format"))) json = strcmp(value, "json") == 0;
+        else if ((value = FlagValue(argv[i], "--benchmark_out"))) outFile = value;
+        else if (strcmp(argv[i], "--benchmark_list_tests") == 0) listOnly = true;
+        else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            fprintf(stderr, "Options: --benchmark_filter=REGEX --benchmark_min_time=S --benchmark_format=console|json\n");
+            fprintf(stderr, "         --benchmark_out=FILE (JSON) --benchmark_list_tests\n");
+            return 1;
+        }
+    }
+
+    std::regex pattern;
+    try {
+        pattern = std::regex(filter);
+    }
+    catch (const std::regex_error&) {
+        fprintf(stderr, "Invalid --benchmark_filter '%s'\n", filter.c_str());
+        return 1;
+    }
+
+    if (!json && !listOnly) {
+        printf("%-44s %15s %15s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+        printf("%s\n", std::string(90, '-').c_str());
+    }
+
+    std::vector<BenchResult> results;
+    for (const auto& bench : Registry()) {
+        std::vector<std::vector<int64_t>> argSets = bench->argSets;
+        if (argSets.empty()) argSets.push_back({});
+
+        for (const std::vector<int64_t>& args : argSets) {
+            std::string name = RunName(*bench, args);
+            if (!std::regex_search(name, pattern)) continue;
+            if (listOnly) {
+                printf("%s\n", name.c_str());
+                continue;
+            }
+
+            results.push_back(RunOne(*bench, args, minTime));
+            if (!json) {
+                PrintConsole(results.back());
+                fflush(stdout);
+            }
+        }
+    }
+
+    if (json) WriteJson(stdout, results);
+    if (outFile != nullptr) {
+        FILE* file = fopen(outFile, "w");
+        if (file == nullptr) {
+            fprintf(stderr, "Can't write %s\n", outFile);
+            return 1;
+        }
+        WriteJson(file, results);
+        fclose(file);
+    }
+    return 0;
+}
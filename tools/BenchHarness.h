@@ -0,0 +1,100 @@
+#pragma once
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------------
+// Minimal Google Benchmark work-alike for the micro_bench tool
+// Same shape as the real thing so the kernels read familiar and the JSON output can be
+// diffed with Google Benchmark's compare.py:
+//
+//   static void BM_Kernel(BenchState& state) {
+//       Setup(state.range(0));
+//       while (state.KeepRunning()) { ... DoNotOptimize(result); }
+//       state.SetItemsProcessed(state.iterations() * state.range(0));
+//   }
+//   BENCHMARK(BM_Kernel)->Arg(64)->Arg(1024);
+//
+// Each benchmark/argument pair runs with a growing iteration count until one batch takes
+// at least --benchmark_min_time seconds, then reports time per iteration.
+//------------------------------------------------------------------------------------
+class BenchState {
+public:
+    BenchState(const std::vector<int64_t>& benchArgs, int64_t maxIterations);
+
+    bool KeepRunning();
+    void PauseTiming();  // Exclude setup inside the loop; the clock reads still show up in cpu_time of tiny kernels
+    void ResumeTiming();
+    void SkipWithError(const char* message);
+
+    int64_t range(int index = 0) const { return args[index]; }
+    int64_t iterations() const { return completed; }
+    void SetItemsProcessed(int64_t items) { itemsProcessed = items; }
+    void SetLabel(const std::string& text) { label = text; }
+
+    // Results, read by the runner
+    double realSeconds;
+    double cpuSeconds;
+    int64_t itemsProcessed;
+    std::string label;
+    std::string error;
+
+private:
+    void StartTimers();
+    void StopTimers();
+
+    std::vector<int64_t> args;
+    int64_t maxIterations;
+    int64_t completed;
+    bool started;
+    bool running;
+    std::chrono::steady_clock::time_point realStart;
+    double cpuStart;
+};
+
+typedef void (*BenchFunction)(BenchState& state);
+
+class BenchRegistration {
+public:
+    BenchRegistration(const char* benchName, BenchFunction benchFunction);
+
+    BenchRegistration* Arg(int64_t value);
+    BenchRegistration* Args(std::initializer_list<int64_t> values);
+
+    std::string name;
+    BenchFunction function;
+    std::vector<std::vector<int64_t>> argSets; // Empty: run once without arguments
+};
+
+BenchRegistration* RegisterBenchmark(const char* name, BenchFunction function);
+
+// Parses --benchmark_filter / _min_time / _format / _out / --benchmark_list_tests, runs
+// every matching benchmark. Returns the process exit code.
+int RunBenchmarks(int argc, char** argv);
+
+// Keeps the compiler from discarding a value or the writes leading up to it
+#if defined(_MSC_VER)
+#include <intrin.h>
+template <typename T> inline void DoNotOptimize(const T& value) {
+    const volatile char* p = reinterpret_cast<const volatile char*>(&value);
+    (void)*p;
+    _ReadWriteBarrier();
+}
+inline void ClobberMemory() { _ReadWriteBarrier(); }
+#else
+template <typename T> inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+#endif
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+#define BENCHMARK(fn) static BenchRegistration* BENCH_CONCAT(benchRegistration, __LINE__) = RegisterBenchmark(#fn, fn)
+
+#endif // BENCH_HARNESS_H
@@ -0,0 +1,194 @@
+/*******************************************************************************************
+*
+*   Microbenchmarks for the per-frame kernels, the baseline for performance changes
+*
+*   micro_bench [--benchmark_filter=REGEX] [--benchmark_min_time=S]
+*               [--benchmark_format=console|json] [--benchmark_out=FILE]
+*
+*   Output follows Google Benchmark's JSON schema, so two runs can be compared with its
+*   tools/compare.py. Kernels here only need the simulation library; the raylib ones
+*   (floating text, draw batches) live in MicroBenchDraw.cpp.
+*
+********************************************************************************************/
+
+#include "BenchHarness.h"
+#include "Simulation.h"
+#include "Collision.h"
+#include "BrickGrid.h"
+#include "Random.h"
+
+#include <algorithm> // For std::remove_if, std::max
+#include <cmath>
+#include <vector>
+
+// Ball positions spread over (and a little around) a grid's bounding box
+static std::vector<Vector2> ScatterPoints(const BrickGrid& grid, int count, uint64_t stream) {
+    Random random(7, stream);
+    float width = grid.cols * grid.pitchX;
+    float height = grid.rows * grid.pitchY;
+    std::vector<Vector2> points(count);
+    for (Vector2& p : points) {
+        p.x = grid.originX - 20.0f + random.NextFloat() * (width + 40.0f);
+        p.y = grid.originY - 20.0f + random.NextFloat() * (height + 40.0f);
+    }
+    return points;
+}
+
+// Square-ish brick grid with range(0) bricks
+static BrickGrid MakeGrid(int64_t bricks) {
+    int cols = (int)std::max<int64_t>(1, (int64_t)std::sqrt((double)bricks * 2.0));
+    int rows = (int)std::max<int64_t>(1, bricks / cols);
+    BrickGrid grid;
+    grid.Init(10.0f, 50.0f, 40.0f, 15.0f, 2.0f, rows, cols);
+    return grid;
+}
+
+//------------------------------------------------------------------------------------
+// Circle vs brick rectangles (the CheckCollisionCircleRec maths, see Collision.h)
+//------------------------------------------------------------------------------------
+
+// Every ball against every brick: what the original ball loop did
+static void BM_CircleRecGridBruteForce(BenchState& state) {
+    BrickGrid grid = MakeGrid(state.range(0));
+    std::vector<Rectangle> rects;
+    for (int r = 0; r < grid.rows; ++r)
+        for (int c = 0; c < grid.cols; ++c) rects.push_back(grid.GetCellRect(r, c));
+    std::vector<Vector2> balls = ScatterPoints(grid, 64, 1);
+
+    while (state.KeepRunning()) {
+        int hits = 0;
+        for (const Vector2& ball : balls) {
+            for (const Rectangle& rect : rects) hits += CircleIntersectsRect(ball, 10.0f, rect);
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)balls.size() * (int64_t)rects.size());
+}
+BENCHMARK(BM_CircleRecGridBruteForce)->Arg(64)->Arg(512)->Arg(4096);
+
+// Only the cells under each ball's bounding box, as the simulation does now
+static void BM_CircleRecGridCells(BenchState& state) {
+    BrickGrid grid = MakeGrid(state.range(0));
+    std::vector<Vector2> balls = ScatterPoints(grid, 64, 1);
+
+    while (state.KeepRunning()) {
+        int hits = 0;
+        for (const Vector2& ball : balls) {
+            CellRange cells;
+            if (!grid.QueryCells({ ball.x - 10.0f, ball.y - 10.0f, 20.0f, 20.0f }, &cells)) continue;
+            for (int r = cells.rowMin; r <= cells.rowMax; ++r)
+                for (int c = cells.colMin; c <= cells.colMax; ++c) hits += CircleIntersectsRect(ball, 10.0f, grid.GetCellRect(r, c));
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)balls.size());
+}
+BENCHMARK(BM_CircleRecGridCells)->Arg(64)->Arg(512)->Arg(4096);
+
+//------------------------------------------------------------------------------------
+// Ball loop: Simulation::Step with range(0) balls in play (integration, paddle and
+// brick sweeps, walls, cleanup). The field is restored every simulated second so the
+// ball count and brick layout stay representative.
+//------------------------------------------------------------------------------------
+static void BM_BallLoop(BenchState& state) {
+    const int ballCount = (int)state.range(0);
+
+    SimConfig config = DefaultSimConfig();
+    config.maxBalls = ballCount;
+    config.modifierChance = 0.0f;
+
+    Simulation start;
+    start.Init(1, config);
+    start.balls.Clear();
+    Random random(3, 1);
+    for (int i = 0; i < ballCount; ++i) {
+        Vector2 pos = { 20.0f + random.NextFloat() * (config.fieldWidth - 40.0f), config.fieldHeight * (0.3f + 0.4f * random.NextFloat()) };
+        Vector2 speed = { random.NextFloat() * 600.0f - 300.0f, -(200.0f + random.NextFloat() * 200.0f) };
+        start.balls.Add(pos, speed, BALL_RADIUS);
+    }
+
+    Simulation simulation = start;
+    SimInput input = {};
+    int ticks = 0;
+    int64_t ballTicks = 0;
+
+    while (state.KeepRunning()) {
+        if (ticks == (int)SIM_TICK_RATE) {
+            state.PauseTiming();
+            simulation = start;
+            ticks = 0;
+            state.ResumeTiming();
+        }
+        ballTicks += simulation.balls.Count();
+        simulation.Step(input, SIM_DT);
+        ticks++;
+    }
+    state.SetItemsProcessed(ballTicks);
+}
+BENCHMARK(BM_BallLoop)->Arg(1)->Arg(16)->Arg(256)->Arg(4096);
+
+//------------------------------------------------------------------------------------
+// Cleanup passes: compacting out the dead entries after a tick. Half the entries
+// (every other one) are dead, the worst case for order-preserving compaction.
+// Compaction consumes its input, so every iteration gets its own copy. The copies are
+// refilled a batch at a time with the timers paused; pausing around each copy would
+// mostly time the CPU clock reads.
+//------------------------------------------------------------------------------------
+const int COMPACTION_BATCH_ENTRIES = 16384; // Entries copied per pause
+
+static void BM_RemoveInactiveBalls(BenchState& state) {
+    const int count = (int)state.range(0);
+    BallPool start;
+    for (int i = 0; i < count; ++i) {
+        start.Add({ (float)i, (float)i }, { 100.0f, -100.0f }, BALL_RADIUS);
+        start.active[i] = (unsigned char)(i & 1);
+    }
+
+    std::vector<BallPool> copies(std::max(1, COMPACTION_BATCH_ENTRIES / count));
+    size_t next = copies.size();
+    while (state.KeepRunning()) {
+        if (next == copies.size()) {
+            state.PauseTiming();
+            for (BallPool& copy : copies) copy = start;
+            next = 0;
+            state.ResumeTiming();
+        }
+
+        BallPool& balls = copies[next++];
+        balls.RemoveInactive();
+        DoNotOptimize(balls.x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RemoveInactiveBalls)->Arg(16)->Arg(256)->Arg(4096);
+
+static void BM_RemoveInactiveModifiers(BenchState& state) {
+    const int count = (int)state.range(0);
+    std::vector<Modifier> start(count);
+    for (int i = 0; i < count; ++i) {
+        start[i].Init({ (float)i, 0.0f }, (i % 3) ? MOD_MULTIBALL : MOD_SCORE_BONUS);
+        start[i].active = (i & 1) != 0;
+    }
+
+    std::vector<std::vector<Modifier>> copies(std::max(1, COMPACTION_BATCH_ENTRIES / count));
+    size_t next = copies.size();
+    while (state.KeepRunning()) {
+        if (next == copies.size()) {
+            state.PauseTiming();
+            for (std::vector<Modifier>& copy : copies) copy.assign(start.begin(), start.end());
+            next = 0;
+            state.ResumeTiming();
+        }
+
+        // Same pass as the end of Simulation::Step
+        std::vector<Modifier>& modifiers = copies[next++];
+        modifiers.erase(std::remove_if(modifiers.begin(), modifiers.end(), [](const Modifier& m) { return !m.active; }), modifiers.end());
+        DoNotOptimize(modifiers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RemoveInactiveModifiers)->Arg(16)->Arg(256)->Arg(4096);
+
+int main(int argc, char** argv) {
+    return RunBenchmarks(argc, argv);
+}
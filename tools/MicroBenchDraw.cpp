@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------------
+// micro_bench kernels that need raylib: floating text and draw batch submission
+// Linked against raylib_null (PLATFORM_NULL), so the draw benchmarks time rlgl's batching
+// with no GPU behind it. They open the window on first use and are skipped if that fails.
+//------------------------------------------------------------------------------------
+
+#include "BenchHarness.h"
+#include "FloatingText.h"
+#include "BrickGrid.h"
+#include "Random.h"
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <cstdlib> // For atexit
+#include <vector>
+
+static bool EnsureWindow() {
+    static bool tried = false;
+    if (!tried) {
+        tried = true;
+        SetTraceLogLevel(LOG_WARNING);
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+        InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "micro_bench");
+        if (IsWindowReady()) atexit(CloseWindow);
+    }
+    return IsWindowReady();
+}
+
+//------------------------------------------------------------------------------------
+// raylib's own CheckCollisionCircleRec against a grid, next to the simulation's copy
+//------------------------------------------------------------------------------------
+static void BM_RaylibCheckCollisionCircleRec(BenchState& state) {
+    BrickGrid grid;
+    int cols = (int)state.range(0) / 8;
+    grid.Init(10.0f, 50.0f, 40.0f, 15.0f, 2.0f, 8, cols > 0 ? cols : 1);
+    std::vector<Rectangle> rects;
+    for (int r = 0; r < grid.rows; ++r)
+        for (int c = 0; c < grid.cols; ++c) rects.push_back(grid.GetCellRect(r, c));
+
+    Random random(7, 1);
+    std::vector<Vector2> balls(64);
+    for (Vector2& b : balls) b = { random.NextFloat() * grid.cols * grid.pitchX, 50.0f + random.NextFloat() * grid.rows * grid.pitchY };
+
+    while (state.KeepRunning()) {
+        int hits = 0;
+        for (const Vector2& ball : balls) {
+            for (const Rectangle& rect : rects) hits += CheckCollisionCircleRec(ball, 10.0f, rect);
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)balls.size() * (int64_t)rects.size());
+}
+BENCHMARK(BM_RaylibCheckCollisionCircleRec)->Arg(64)->Arg(512)->Arg(4096);
+
+//------------------------------------------------------------------------------------
+// Floating text: a burst of range(0) spawns into the pool, then updates until it drains
+//------------------------------------------------------------------------------------
+static void BM_FloatingTextSpawn(BenchState& state) {
+    const int spawns = (int)state.range(0);
+    FloatingTextPool pool;
+    Font font = {};
+
+    while (state.KeepRunning()) {
+        for (int i = 0; i < spawns; ++i) {
+            pool.Spawn(&font, { (float)i, 300.0f }, { 0.0f, -50.0f }, "SMASH!", GOLD, 40, 0.85f + 0.001f * i);
+        }
+        DoNotOptimize(pool.Count());
+        pool.Clear(); // Just resets the count, cheaper than pausing the timers around it
+    }
+    state.SetItemsProcessed(state.iterations() * spawns);
+}
+BENCHMARK(BM_FloatingTextSpawn)->Arg(8)->Arg(64)->Arg(1024);
+
+static void BM_FloatingTextUpdate(BenchState& state) {
+    FloatingTextPool pool;
+    Font font = {};
+    Random random(11, 1);
+
+    // Lifetimes outlast the longest run (1e9 frames at 1/144 s is ~7e6 s), so the pool is
+    // filled once and the timed loop never pauses to top it up
+    const float lifeTime = 1.0e8f;
+    for (int i = 0; i < (int)state.range(0); ++i) {
+        pool.Spawn(&font, { random.NextFloat() * 800.0f, 300.0f }, { 0.0f, -50.0f }, "POP!", GOLD, 40, lifeTime);
+    }
+
+    while (state.KeepRunning()) {
+        pool.Update(1.0f / 144.0f);
+        DoNotOptimize(pool.Count());
+    }
+    state.SetItemsProcessed(state.iterations() * pool.Count());
+}
+BENCHMARK(BM_FloatingTextUpdate)->Arg(8)->Arg(MAX_FLOATING_TEXTS);
+
+//------------------------------------------------------------------------------------
+// Draw submission: range(0) shapes pushed into rlgl's batch, then the batch flushed
+//------------------------------------------------------------------------------------
+static void BM_DrawRectangleVBatch(BenchState& state) {
+    if (!EnsureWindow()) {
+        state.SkipWithError("no window");
+        return;
+    }
+    const int count = (int)state.range(0);
+
+    while (state.KeepRunning()) {
+        for (int i = 0; i < count; ++i) {
+            DrawRectangleV({ (float)(i % 100) * 8.0f, (float)(i / 100 % 60) * 10.0f }, { 7.0f, 9.0f }, RED);
+        }
+        rlDrawRenderBatchActive();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DrawRectangleVBatch)->Arg(64)->Arg(1024)->Arg(16384);
+
+static void BM_DrawCircleVBatch(BenchState& state) {
+    if (!EnsureWindow()) {
+        state.SkipWithError("no window");
+        return;
+    }
+    const int count = (int)state.range(0);
+
+    while (state.KeepRunning()) {
+        for (int i = 0; i < count; ++i) {
+            DrawCircleV({ (float)(i % 100) * 8.0f, (float)(i / 100 % 60) * 10.0f }, BALL_RADIUS, WHITE);
+        }
+        rlDrawRenderBatchActive();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DrawCircleVBatch)->Arg(16)->Arg(256)->Arg(4096);
@@ -0,0 +1,123 @@
+/*******************************************************************************************
+*
+*   Audio mixing benchmark: raudio MixSamples kernels, scalar vs SIMD
+*
+*   Builds raudio.c into this program (no file formats, no audio device) to reach its
+*   static kernels, checks every SIMD path is bit-exact with the scalar one and times a
+*   hit storm: many voices mixed into one device period.
+*
+********************************************************************************************/
+
+#define EXTERNAL_CONFIG_FLAGS       // Only the audio module, no file format loaders
+#define SUPPORT_MODULE_RAUDIO
+#define SUPPORT_TRACELOG
+#include "raudio.c"
+#include "utils.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_VOICES            32          // Simultaneous hit sounds
+#define BENCH_PERIOD_FRAMES     480         // Frames per device callback (10 ms at 48 kHz)
+#define BENCH_SAMPLE_RATE       48000
+#define BENCH_CALLBACKS         20000
+
+// rcore file helpers referenced by raudio.c, unused without file formats
+bool IsFileExtension(const char *fileName, const char *ext) { (void)fileName; (void)ext; return false; }
+const char *GetFileExtension(const char *fileName) { (void)fileName; return NULL; }
+const char *GetFileNameWithoutExt(const char *filePath) { return filePath; }
+
+typedef struct MixKernel {
+    const char *name;
+    MixSamplesFunc func;
+} MixKernel;
+
+static float RandomSample(void)
+{
+    return (float)rand()/(float)RAND_MAX*2.0f - 1.0f;
+}
+
+// Same inputs through kernel and scalar, results must match exactly (mul then add, no FMA)
+static bool CheckKernel(MixSamplesFunc kernel)
+{
+    float in[67], outScalar[67], outKernel[67];
+
+    for (ma_uint32 count = 0; count <= 67; count++)
+    {
+        for (int i = 0; i < 67; i++) { in[i] = RandomSample(); outScalar[i] = outKernel[i] = RandomSample(); }
+
+        MixSamplesScalar(outScalar, in, count, 0.7f, 0.3f);
+        kernel(outKernel, in, count, 0.7f, 0.3f);
+
+        if (memcmp(outScalar, outKernel, sizeof(outScalar)) != 0) return false;
+    }
+
+    return true;
+}
+
+static double TimeKernel(MixSamplesFunc kernel, float *voices, float *out)
+{
+    const ma_uint32 samples = BENCH_PERIOD_FRAMES*2;
+    ma_timer timer;
+    ma_timer_init(&timer);
+
+    double start = ma_timer_get_time_in_seconds(&timer);
+    for (int callback = 0; callback < BENCH_CALLBACKS; callback++)
+    {
+        memset(out, 0, samples*sizeof(float));
+        for (int v = 0; v < BENCH_VOICES; v++) kernel(out, voices + v*samples, samples, 0.6f, 0.4f);
+    }
+    double elapsed = ma_timer_get_time_in_seconds(&timer) - start;
+
+    return elapsed/BENCH_CALLBACKS;     // Seconds per callback
+}
+
+int main(void)
+{
+    MixKernel kernels[4] = { 0 };
+    int kernelCount = 0;
+
+    kernels[kernelCount++] = (MixKernel){ "scalar", MixSamplesScalar };
+#if defined(RAUDIO_MIX_SSE2)
+    kernels[kernelCount++] = (MixKernel){ "SSE2", MixSamplesSSE2 };
+#endif
+#if defined(RAUDIO_MIX_AVX)
+    if (IsCpuAVXSupported()) kernels[kernelCount++] = (MixKernel){ "AVX", MixSamplesAVX };
+#endif
+#if defined(RAUDIO_MIX_NEON)
+    kernels[kernelCount++] = (MixKernel){ "NEON", MixSamplesNEON };
+#endif
+
+    const char *selected = NULL;
+    SelectMixSamplesKernel(&selected);
+
+    const ma_uint32 samples = BENCH_PERIOD_FRAMES*2;
+    float *voices = (float *)malloc(BENCH_VOICES*samples*sizeof(float));
+    float *out = (float *)malloc(samples*sizeof(float));
+    for (ma_uint32 i = 0; i < BENCH_VOICES*samples; i++) voices[i] = RandomSample();
+
+    const double budget = (double)BENCH_PERIOD_FRAMES/BENCH_SAMPLE_RATE;
+
+    printf("Mixing %i stereo voices, %i frames per callback (%.1f ms budget), dispatch selects %s\n",
+        BENCH_VOICES, BENCH_PERIOD_FRAMES, budget*1000.0, selected);
+    printf("%-8s %12s %10s %10s %8s\n", "kernel", "us/callback", "speedup", "budget", "exact");
+
+    double scalarTime = 0.0;
+    bool allExact = true;
+
+    for (int k = 0; k < kernelCount; k++)
+    {
+        bool exact = CheckKernel(kernels[k].func);
+        double t = TimeKernel(kernels[k].func, voices, out);
+        if (k == 0) scalarTime = t;
+        allExact = allExact && exact;
+
+        printf("%-8s %12.2f %9.2fx %9.3f%% %8s\n", kernels[k].name, t*1e6, scalarTime/t, t/budget*100.0, exact? "yes" : "NO");
+    }
+
+    free(voices);
+    free(out);
+
+    return allExact? 0 : 1;
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************************
+*
+*   Render CPU cost: plays the game headless through raylib's null platform
+*
+*   render_bench [frames] [fps]    (defaults: 3000 frames at 144 fps)
+*
+*   Runs the real UpdateDrawFrame() (simulation, floating text, board cache, HUD text,
+*   rlgl batching) with every OpenGL call stubbed out, so it needs no display or GPU.
+*   Frame times are fixed at 1/fps of game time; what gets measured is the CPU time of
+*   each frame and of each profiler zone. Nobody steers the paddle: each game runs until
+*   the balls are lost, then a new one starts (and, as in the game, leaves its replay in
+*   last_session.bbreplay). Run it from the repository root so the font and sounds load.
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "Constants.h"
+#include "GameState.h"
+#include "Profiler.h"
+#include "FrameHistogram.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static void PrintRow(const char* name, int depth, const FrameHistogram& histogram) {
+    printf("%*s%-*s %9.1f %9u %9u %9u\n", depth * 2, "", 24 - depth * 2, name,
+        histogram.GetMean(), histogram.GetPercentile(50.0), histogram.GetPercentile(99.0), histogram.GetMax());
+}
+
+int main(int argc, char** argv) {
+    int frames = (argc > 1) ? atoi(argv[1]) : 3000;
+    int fps = (argc > 2) ? atoi(argv[2]) : 144;
+    if (frames < 1 || fps < 1) {
+        fprintf(stderr, "Usage: render_bench [frames] [fps]\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "render_bench");
+    if (!IsWindowReady()) {
+        fprintf(stderr, "Failed to initialize the null graphics device\n");
+        return 1;
+    }
+    InitAudioDevice();
+    SetTargetFPS(fps); // The null platform skips the wait, so every frame is exactly 1/fps of game time
+    SetProfilerThread();
+    LoadGameResources();
+
+    InitGame();
+    currentGameState = PLAYING;
+
+    FrameHistogram frameTimes;                  // Whole UpdateDrawFrame() calls, us
+    std::vector<FrameHistogram> zoneTimes(MAX_PROFILE_ZONES);
+    int games = 1;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        auto start = std::chrono::steady_clock::now();
+        UpdateDrawFrame();
+        double frameUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        frameTimes.Record((uint32_t)(frameUs + 0.5)); // Rounded like the zones below, not truncated
+
+        // UpdateDrawFrame() closes the previous frame's zones as it starts
+        if (frame > 0) {
+            for (int zone = 0; zone < GetProfileZoneCount(); ++zone) {
+                zoneTimes[zone].Record((uint32_t)(GetProfileZoneHistoryMs(zone, 0) * 1000.0f + 0.5f));
+            }
+        }
+
+        if (currentGameState == GAME_OVER) {
+            InitGame();
+            currentGameState = PLAYING;
+            games++;
+        }
+    }
+
+    printf("%d frames at %d fps (%.1f s of game time), %d games, null renderer\n", frames, fps, (double)frames / fps, games);
+    printf("%-24s %9s %9s %9s %9s\n", "CPU time (us)", "mean", "p50", "p99", "max");
+    PrintRow("Frame", 0, frameTimes);
+    if (IsProfilerCompiledIn()) {
+        int order[MAX_PROFILE_ZONES];
+        int listed = GetProfileZoneOrder(order);
+        for (int i = 0; i < listed; ++i) {
+            ProfileZoneStats stats;
+            if (GetProfileZoneStats(order[i], &stats)) PrintRow(stats.name, stats.depth + 1, zoneTimes[order[i]]);
+        }
+    }
+
+    replayRecorder.Stop(); // The unfinished last game isn't worth a replay file
+    UnloadGameResources();
+    CloseAudioDevice();
+    CloseWindow();
+    return 0;
+}
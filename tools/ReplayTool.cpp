@@ -0,0 +1,83 @@
+/*******************************************************************************************
+*
+*   Replay tool: plays a recorded session through the headless simulation
+*
+*   replay_tool <file>                          Replays every tick and checks the final state
+*                                               against the recorded checksum
+*   replay_tool --record <file> <seed> [secs]   Records a session played by the
+*                                               SimBot (default 120 s)
+*
+*   No window or audio device is opened, ticks run as fast as the CPU allows.
+*
+********************************************************************************************/
+
+#include "Simulation.h"
+#include "Replay.h"
+#include "SimBot.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static int Record(const char* fileName, unsigned int seed, float seconds) {
+    Simulation simulation;
+    simulation.Init(seed);
+
+    ReplayRecorder recorder;
+    recorder.Begin(seed, simulation.config);
+    SimBot bot;
+    bot.Init(DefaultBotConfig(), seed);
+
+    const unsigned long long maxTicks = (unsigned long long)(seconds * SIM_TICK_RATE);
+    while (!simulation.gameOver && recorder.GetTickCount() < maxTicks) {
+        SimInput input = bot.Think(simulation);
+        recorder.Record(input);
+        simulation.Step(input, SIM_DT);
+    }
+
+    if (!recorder.Save(fileName, simulation)) {
+        fprintf(stderr, "Failed to write %s\n", fileName);
+        return 1;
+    }
+
+    std::vector<unsigned char> bytes;
+    recorder.Serialize(simulation, bytes);
+    printf("Recorded %llu ticks (%.1f s), score %d, %zu bytes -> %s\n",
+        recorder.GetTickCount(), recorder.GetTickCount() / SIM_TICK_RATE, simulation.score, bytes.size(), fileName);
+    return 0;
+}
+
+static int Play(const char* fileName) {
+    ReplayPlayer player;
+    if (!player.Load(fileName)) {
+        fprintf(stderr, "Failed to load %s (missing file, not a version %d replay, or an unplayable config)\n", fileName, (int)REPLAY_VERSION);
+        return 1;
+    }
+
+    printf("Seed %u, %llu ticks at %.0f Hz (%.1f s), %d x %d bricks\n",
+        player.GetSeed(), player.GetTickCount(), player.GetTickRate(), player.GetTickCount() / player.GetTickRate(),
+        player.GetConfig().brickRows, player.GetConfig().brickColumns);
+
+    Simulation simulation;
+    auto start = std::chrono::steady_clock::now();
+    bool matched = player.Run(simulation);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Final score %d (recorded %d), checksum %08x (recorded %08x)\n",
+        simulation.score, player.GetFinalScore(), simulation.Checksum(), player.GetFinalChecksum());
+    printf("Replayed in %.3f s, %.0f ticks/s\n", elapsed, elapsed > 0.0 ? player.GetTickCount() / elapsed : 0.0);
+    printf("%s\n", matched ? "MATCH" : "MISMATCH");
+    return matched ? 0 : 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 4 && strcmp(argv[1], "--record") == 0) {
+        float seconds = (argc >= 5) ? (float)atof(argv[4]) : 120.0f;
+        return Record(argv[2], (unsigned int)strtoul(argv[3], NULL, 10), seconds);
+    }
+    if (argc == 2) return Play(argv[1]);
+
+    fprintf(stderr, "Usage: %s <file>\n       %s --record <file> <seed> [seconds]\n", argv[0], argv[0]);
+    return 1;
+}